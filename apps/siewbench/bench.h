@@ -0,0 +1,50 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_BENCH_H
+#define SIEWLANGC_BENCH_H
+
+#include <time.h>
+
+#include "siew/common.h"
+
+// wall clock in seconds, good enough for the sizes we measure here
+static inline double benchNow() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// what the command line asked for, only the suite (and throughput, maxSourceSize) use them (the other benchmarks print what they measure and that's it)
+typedef struct {
+    int warmup; // samples thrown away before measuring
+    int repetitions; // samples measured
+    const char* jsonPath; // write the results here, NULL for none
+    const char* baselinePath; // results of an earlier run to compare with, NULL for none
+    size_t maxSourceSize; // the throughput benchmark goes up to sources this big
+} BenchOptions;
+
+extern BenchOptions benchOptions;
+extern bool benchRegressed; // a benchmark compared itself with the baseline and got significantly slower
+
+void benchStrings();
+void benchIntern();
+void benchSlice();
+void benchCompile();
+void benchMemory();
+void benchScanner();
+void benchStream();
+void benchNumber();
+void benchOutput();
+void benchDispatch();
+void benchVerify();
+void benchOpcodes();
+void benchLiterals();
+void benchSuite();
+void benchThroughput();
+void benchBackends();
+void benchIntegers();
+void benchArrays();
+
+#endif //SIEWLANGC_BENCH_H
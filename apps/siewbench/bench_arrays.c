@@ -0,0 +1,255 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/array.h"
+#include "siew/chunk.h"
+#include "siew/object.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+#define MIN_MEASURE 0.1 // seconds per kernel, size and version
+#define VM_COUNT (64 * 1024) // elements of the arrays the VM adds up
+#define VM_HEAP_LIMIT (8 * 1024 * 1024) // every run leaves a 512 KB result behind, this is when they get collected
+#define REDUCTION_TOLERANCE 1e-9 // relative, the vector sums add in another order
+
+// 8 KB (L1), 512 KB (L2) and 8 MB (memory, on most machines) per array
+static const int sizes[] = {1024, 64 * 1024, 1024 * 1024};
+
+typedef enum {
+    KERNEL_ELEMENTWISE,
+    KERNEL_REDUCE, // one array in, one double out
+    KERNEL_DOT,
+} KernelShape;
+
+typedef struct {
+    const char* name;
+    KernelShape shape;
+    void (*elementwise)(double* out, const double* a, const double* b, int count);
+    double (*reduce)(const double* values, int count);
+} Kernel;
+
+static const Kernel kernels[] = {
+    {"add", KERNEL_ELEMENTWISE, arrayAdd, NULL},
+    {"multiply", KERNEL_ELEMENTWISE, arrayMultiply, NULL},
+    {"divide", KERNEL_ELEMENTWISE, arrayDivide, NULL},
+    {"less mask", KERNEL_ELEMENTWISE, arrayLessMask, NULL},
+    {"equal mask", KERNEL_ELEMENTWISE, arrayEqualMask, NULL},
+    {"sum", KERNEL_REDUCE, NULL, arraySum},
+    {"min", KERNEL_REDUCE, NULL, arrayMin},
+    {"max", KERNEL_REDUCE, NULL, arrayMax},
+    {"dot", KERNEL_DOT, NULL, NULL},
+};
+
+// xorshift64 again, the same data on every machine. Values in [-1000, 1000) with two decimals
+static void fillRandom(double* values, int count, uint64_t seed) {
+    uint64_t state = seed;
+    for (int i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        values[i] = (double)((int64_t)(state >> 40) % 200000 - 100000) / 100.0;
+    }
+}
+
+// Runs the kernel once, the result goes to out (elementwise) or is returned
+static double runKernel(const Kernel* kernel, double* out, const double* a, const double* b, int count) {
+    switch (kernel->shape) {
+        case KERNEL_ELEMENTWISE: kernel->elementwise(out, a, b, count); return 0;
+        case KERNEL_REDUCE: return kernel->reduce(a, count);
+        case KERNEL_DOT: return arrayDot(a, b, count);
+    }
+    return 0;
+}
+
+// seconds per call. The kernels live in the library, the compiler can't drop a call whose result we don't use
+static double timeKernel(const Kernel* kernel, double* out, const double* a, const double* b, int count) {
+    int calls = 0;
+    double start = benchNow();
+    double elapsed;
+    do {
+        runKernel(kernel, out, a, b, count);
+        calls++;
+        elapsed = benchNow() - start;
+    } while (elapsed < MIN_MEASURE);
+    return elapsed / calls;
+}
+
+static bool sameResult(const Kernel* kernel, double scalar, double vector, const double* scalarOut,
+                       const double* vectorOut, int count) {
+    switch (kernel->shape) {
+        // the same IEEE operation on the same two doubles, element by element: the bits have to match
+        case KERNEL_ELEMENTWISE: return memcmp(scalarOut, vectorOut, sizeof(double) * (size_t)count) == 0;
+        case KERNEL_REDUCE:
+            if (kernel->reduce != arraySum) return scalar == vector;
+            // fall through
+        case KERNEL_DOT: return fabs(scalar - vector) <= REDUCTION_TOLERANCE * fmax(1.0, fabs(scalar));
+    }
+    return false;
+}
+
+static void measureKernel(const Kernel* kernel, int count, const double* a, const double* b) {
+    double* scalarOut = malloc(sizeof(double) * (size_t)count);
+    double* vectorOut = malloc(sizeof(double) * (size_t)count);
+
+    setArrayVectorized(false);
+    double scalar = runKernel(kernel, scalarOut, a, b, count);
+    double scalarTime = timeKernel(kernel, scalarOut, a, b, count);
+    setArrayVectorized(true);
+    double vector = runKernel(kernel, vectorOut, a, b, count);
+    double vectorTime = timeKernel(kernel, vectorOut, a, b, count);
+
+    bool same = sameResult(kernel, scalar, vector, scalarOut, vectorOut, count);
+    // what the kernel reads and writes
+    int arrays = kernel->shape == KERNEL_ELEMENTWISE ? 3 : kernel->shape == KERNEL_DOT ? 2 : 1;
+    double bytes = (double)arrays * sizeof(double) * count;
+    printf("%-12s %10d %10.2f %10.2f %8.2fx%s\n", kernel->name, count, bytes / scalarTime / 1e9,
+        bytes / vectorTime / 1e9, scalarTime / vectorTime, same ? "" : "   RESULT DIFFERS!");
+    if (!same) benchRegressed = true;
+
+    free(scalarOut);
+    free(vectorOut);
+}
+
+static void writeOperand(Chunk* chunk, int slot) {
+    uint8_t bytes[2];
+    writeRegisterOperand(bytes, slot);
+    writeChunk(chunk, bytes[0], 1);
+    writeChunk(chunk, bytes[1], 1);
+}
+
+// slots 0 to 3 are the constants, 4 is the only register
+static void buildRegisterCode(Chunk* chunk, OpCode op, int expected) {
+    writeChunk(chunk, op == OP_ADD ? R_ADD : R_MULTIPLY, 1);
+    writeOperand(chunk, 4);
+    writeOperand(chunk, 0);
+    writeOperand(chunk, 1);
+    writeChunk(chunk, R_EQUAL, 1);
+    writeOperand(chunk, 4);
+    writeOperand(chunk, 4);
+    writeOperand(chunk, expected);
+    writeChunk(chunk, R_RETURN, 1);
+    writeOperand(chunk, 4);
+    chunk->maxStack = 5;
+}
+
+// A hand-made chunk for "a + b == expected" (or a * b), the arrays as constants. The language has no syntax
+// for arrays yet, so this is how a host gets them into a program. Every chunk holds all of them, that way
+// whatever chunk is running keeps them alive if a collection happens. While we build it, the stack does.
+static void buildChunk(Chunk* chunk, Backend backend, ObjArray** arrays, OpCode op, int expected) {
+    for (int i = 0; i < 4; i++) push(OBJ_VAL(arrays[i]));
+    initChunk(chunk);
+    chunk->backend = backend;
+    for (int i = 0; i < 4; i++) addConstant(chunk, OBJ_VAL(arrays[i]));
+    if (backend == BACKEND_STACK) {
+        uint8_t code[] = {OP_CONSTANT, 0, OP_CONSTANT, 1, (uint8_t)op, OP_CONSTANT, (uint8_t)expected, OP_EQUAL, OP_RETURN};
+        for (size_t i = 0; i < sizeof(code); i++) writeChunk(chunk, code[i], 1);
+        chunk->maxStack = 3;
+    } else {
+        buildRegisterCode(chunk, op, expected);
+    }
+    for (int i = 0; i < 4; i++) pop();
+}
+
+static void measureVM(const char* name, Backend backend, bool cacheRegisters, OpCode op, ObjArray** arrays,
+                      OutputSink* sink) {
+    Chunk chunk;
+    buildChunk(&chunk, backend, arrays, op, op == OP_ADD ? 2 : 3);
+    setRegisterCaching(cacheRegisters);
+
+    bool ok = interpretChunk(&chunk) == INTERPRET_OK && strcmp(capturedOutput(sink, NULL), "true\n") == 0;
+    resetCapturedOutput(sink);
+
+    double times[2];
+    for (int vectorized = 0; vectorized < 2; vectorized++) {
+        setArrayVectorized(vectorized);
+        int runs = 0;
+        double start = benchNow();
+        double elapsed;
+        do {
+            if (interpretChunk(&chunk) != INTERPRET_OK) ok = false;
+            resetCapturedOutput(sink);
+            runs++;
+            elapsed = benchNow() - start;
+        } while (elapsed < MIN_MEASURE);
+        times[vectorized] = elapsed / runs;
+    }
+
+    // the operator and the == after it both go through every element
+    printf("%-12s %-14s %10.2f %10.2f %8.2fx%s\n", name, backend == BACKEND_REGISTER ? "register" :
+        cacheRegisters ? "stack" : "stack uncached", times[0] * 1e9 / VM_COUNT, times[1] * 1e9 / VM_COUNT,
+        times[0] / times[1], ok ? "" : "   OUTPUT DIFFERS!");
+    if (!ok) benchRegressed = true;
+
+    freeChunk(&chunk);
+}
+
+// The array kernels with SIMD against the plain scalar loops (setArrayVectorized(false)), in GB/s of the arrays
+// they read and write, at sizes that fit L1, L2 and neither. Every result is checked against the scalar one.
+// The simple scalar loops may get vectorized by the C compiler on its own, the reductions can't be (the order
+// of the additions is part of the result), that's where the hand-written kernels matter most.
+// Then the same kernels under the VM's operators: one dispatch for the whole array, in ns per element.
+void benchArrays() {
+    printf("%-12s %10s %10s %10s %9s\n", "kernel", "elements", "scalar GB/s", "simd GB/s", "speedup");
+    for (size_t size = 0; size < sizeof(sizes) / sizeof(sizes[0]); size++) {
+        int count = sizes[size];
+        double* a = malloc(sizeof(double) * (size_t)count);
+        double* b = malloc(sizeof(double) * (size_t)count);
+        fillRandom(a, count, 0x9E3779B97F4A7C15ull);
+        fillRandom(b, count, 0x2545F4914F6CDD1Dull);
+        // some equal pairs, so the equal mask isn't all zeros
+        for (int i = 0; i < count; i += 7) b[i] = a[i];
+        for (size_t kernel = 0; kernel < sizeof(kernels) / sizeof(kernels[0]); kernel++) {
+            measureKernel(&kernels[kernel], count, a, b);
+        }
+        free(a);
+        free(b);
+        fflush(stdout);
+    }
+
+    initVM();
+    vm.heapLimit = VM_HEAP_LIMIT;
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+
+    // a, b, a + b and a * b. The last two are computed here, without the kernels
+    double* values = malloc(sizeof(double) * VM_COUNT);
+    ObjArray* arrays[4];
+    fillRandom(values, VM_COUNT, 0x9E3779B97F4A7C15ull);
+    arrays[0] = copyArray(values, VM_COUNT);
+    push(OBJ_VAL(arrays[0]));
+    fillRandom(values, VM_COUNT, 0x2545F4914F6CDD1Dull);
+    arrays[1] = copyArray(values, VM_COUNT);
+    push(OBJ_VAL(arrays[1]));
+    for (int i = 0; i < VM_COUNT; i++) values[i] = arrays[0]->values[i] + arrays[1]->values[i];
+    arrays[2] = copyArray(values, VM_COUNT);
+    push(OBJ_VAL(arrays[2]));
+    for (int i = 0; i < VM_COUNT; i++) values[i] = arrays[0]->values[i] * arrays[1]->values[i];
+    arrays[3] = copyArray(values, VM_COUNT);
+    // the register VM starts every run with an empty stack, from here on buildChunk() and the chunks keep them alive
+    pop();
+    pop();
+    pop();
+    free(values);
+
+    printf("\n%-12s %-14s %10s %10s %9s\n", "operator", "backend", "scalar ns", "simd ns", "speedup");
+    measureVM("a + b", BACKEND_STACK, true, OP_ADD, arrays, sink);
+    measureVM("a + b", BACKEND_STACK, false, OP_ADD, arrays, sink);
+    measureVM("a + b", BACKEND_REGISTER, true, OP_ADD, arrays, sink);
+    measureVM("a * b", BACKEND_STACK, true, OP_MULTIPLY, arrays, sink);
+    measureVM("a * b", BACKEND_REGISTER, true, OP_MULTIPLY, arrays, sink);
+    setRegisterCaching(true);
+    setArrayVectorized(true);
+
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
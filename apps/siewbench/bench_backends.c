@@ -0,0 +1,163 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+#define TERMS 2000
+#define DEEP_NESTING 5000
+#define CONCAT_PIECES 100
+#define MIN_MEASURE 0.2 // seconds per backend and source
+
+typedef struct {
+    char* chars;
+    size_t length;
+} SourceBuilder;
+
+static void append(SourceBuilder* builder, const char* text) {
+    size_t length = strlen(text);
+    builder->chars = realloc(builder->chars, builder->length + length + 1);
+    memcpy(builder->chars + builder->length, text, length + 1);
+    builder->length += length;
+}
+
+// 3 * 7 + 12 * 5 + ...: the shape that hurts the stack VM the most, two pushes for every operator
+static char* productsSource() {
+    SourceBuilder builder = {NULL, 0};
+    char piece[32];
+    for (int i = 0; i < TERMS; i++) {
+        snprintf(piece, sizeof(piece), "%d * %d + ", i % 97, i % 13 + 1);
+        append(&builder, piece);
+    }
+    append(&builder, "0");
+    return builder.chars;
+}
+
+// (1 < 2) == (3 >= 4) == ...: comparisons, and >= costs an extra R_NOT/OP_NOT
+static char* comparisonsSource() {
+    SourceBuilder builder = {NULL, 0};
+    char piece[48];
+    for (int i = 0; i < TERMS; i++) {
+        snprintf(piece, sizeof(piece), "(%d < %d) == (%d >= %d) == ", i % 7, i % 5, i % 3, i % 11);
+        append(&builder, piece);
+    }
+    append(&builder, "true");
+    return builder.chars;
+}
+
+// 1 + (2 * (3 - (...))): every level keeps a value alive, so the frame is as big as the stack would be
+static char* deepSource() {
+    static const char* operators[] = {" + (", " * (", " - ("};
+    SourceBuilder builder = {NULL, 0};
+    char piece[16];
+    for (int i = 0; i < DEEP_NESTING; i++) {
+        snprintf(piece, sizeof(piece), "%d%s", i % 9 + 1, operators[i % 3]);
+        append(&builder, piece);
+    }
+    append(&builder, "1");
+    for (int i = 0; i < DEEP_NESTING; i++) append(&builder, ")");
+    return builder.chars;
+}
+
+// "ab" + "cd" + ... == "abcd...": ropes and a flatten, the allocations are the same for both backends
+static char* concatSource() {
+    SourceBuilder builder = {NULL, 0};
+    for (int i = 0; i < CONCAT_PIECES; i++) append(&builder, "\"ab\" + ");
+    append(&builder, "\"\" == \"");
+    for (int i = 0; i < CONCAT_PIECES; i++) append(&builder, "ab");
+    append(&builder, "\"");
+    return builder.chars;
+}
+
+typedef struct {
+    bool ok;
+    int codeBytes;
+    int frame; // maxStack: stack slots or constants + registers
+    uint64_t instructions; // per run
+    double nsPerRun;
+    char* output; // what the first run printed
+} BackendResult;
+
+static BackendResult measureBackend(const char* source, Backend backend, OutputSink* sink) {
+    BackendResult result = {false, 0, 0, 0, 0, NULL};
+    Chunk chunk;
+    initChunk(&chunk);
+    chunk.backend = backend;
+    if (!compile(source, &chunk)) {
+        freeChunk(&chunk);
+        return result;
+    }
+    result.codeBytes = chunk.count;
+    result.frame = chunk.maxStack;
+
+    uint64_t before = vm.stats.instructions;
+    result.ok = interpretChunk(&chunk) == INTERPRET_OK;
+    result.instructions = vm.stats.instructions - before;
+    size_t length;
+    const char* output = capturedOutput(sink, &length);
+    result.output = malloc(length + 1);
+    memcpy(result.output, output, length + 1);
+    resetCapturedOutput(sink);
+
+    // compiled once, only the loop is timed
+    int runs = 0;
+    double start = benchNow();
+    double elapsed;
+    do {
+        interpretChunk(&chunk);
+        resetCapturedOutput(sink);
+        runs++;
+        elapsed = benchNow() - start;
+    } while (elapsed < MIN_MEASURE && result.ok);
+    result.nsPerRun = elapsed / runs * 1e9;
+
+    freeChunk(&chunk);
+    return result;
+}
+
+static void compareBackends(const char* name, char* source, OutputSink* sink) {
+    BackendResult stack = measureBackend(source, BACKEND_STACK, sink);
+    BackendResult registers = measureBackend(source, BACKEND_REGISTER, sink);
+
+    bool same = stack.ok && registers.ok && strcmp(stack.output, registers.output) == 0;
+    printf("%-12s %-8s %8d %6d %12llu %12.0f\n", name, "stack", stack.codeBytes, stack.frame,
+        (unsigned long long)stack.instructions, stack.nsPerRun);
+    printf("%-12s %-8s %8d %6d %12llu %12.0f   %.2fx instructions, %.2fx time%s\n", "", "register",
+        registers.codeBytes, registers.frame, (unsigned long long)registers.instructions, registers.nsPerRun,
+        registers.instructions == 0 ? 0 : (double)stack.instructions / (double)registers.instructions,
+        registers.nsPerRun == 0 ? 0 : stack.nsPerRun / registers.nsPerRun, same ? "" : "   OUTPUT DIFFERS!");
+    // both backends run the same program: anything else is a bug, not a slowdown
+    if (!same) benchRegressed = true;
+
+    free(stack.output);
+    free(registers.output);
+    free(source);
+}
+
+// The same sources through the stack VM and the register VM: how many instructions each one dispatches
+// for a run, and how long the run takes. The speedup columns are stack / register.
+void benchBackends() {
+    initVM();
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+
+    printf("%-12s %-8s %8s %6s %12s %12s\n", "source", "backend", "code", "frame", "instructions", "ns/run");
+    compareBackends("products", productsSource(), sink);
+    compareBackends("comparisons", comparisonsSource(), sink);
+    compareBackends("deep", deepSource(), sink);
+    compareBackends("concat", concatSource(), sink);
+
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
@@ -0,0 +1,101 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/arena.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/vm.h"
+
+#define SOURCE_COUNT 5000
+#define ROUNDS 20
+
+static char sources[SOURCE_COUNT][128];
+
+// small scripts, all a bit different, like the ones we get from tenants
+static void generateSources() {
+    for (int i = 0; i < SOURCE_COUNT; i++) {
+        snprintf(sources[i], sizeof(sources[i]),
+            "(%d + %d) * %d - %d / (%d + 1) == %d == !(%d < %d) == (\"key%d\" == \"key%d\")",
+            i, i + 1, i % 7, i * 3, i % 11, i, i % 5, i % 3, i % 100, i % 50);
+    }
+}
+
+static void compileAll(bool useArena) {
+    initVM();
+    Arena arena;
+    initArena(&arena);
+
+    int bytes = 0;
+    double start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < SOURCE_COUNT; i++) {
+            Chunk chunk;
+            if (useArena) {
+                int length = 0;
+                while (sources[i][length] != '\0') length++;
+                initChunkInArena(&chunk, &arena, length);
+            } else {
+                initChunk(&chunk);
+            }
+
+            compile(sources[i], &chunk);
+            bytes += chunk.count;
+
+            freeChunk(&chunk);
+            if (useArena) resetArena(&arena);
+        }
+    }
+    double end = benchNow();
+
+    int compiles = SOURCE_COUNT * ROUNDS;
+    printf("%-6s %d compiles, %d bytecode bytes: %8.3f ms, %10.0f compiles/s\n",
+        useArena ? "arena" : "heap", compiles, bytes, (end - start) * 1e3, compiles / (end - start));
+
+    freeArena(&arena);
+    freeVM();
+}
+
+#define LARGE_SOURCE_SIZE (16 * 1024 * 1024)
+
+// One huge expression. It only uses literals that don't need the constant pool (OP_CONSTANT can't address
+// more than 256 constants), so its size is only limited by the memory we give it.
+static void compileLarge() {
+    static const char* piece = "!(true == false) == (nil == nil)\n    == !!(false == !true) == ";
+    size_t pieceLength = strlen(piece);
+    char* source = malloc(LARGE_SOURCE_SIZE + 64);
+    size_t length = 0;
+    while (length + pieceLength < LARGE_SOURCE_SIZE) {
+        memcpy(source + length, piece, pieceLength);
+        length += pieceLength;
+    }
+    memcpy(source + length, "true", 5);
+    length += 4;
+
+    initVM();
+    Chunk chunk;
+    initChunkInArena(&chunk, &vm.compileArena, (int)length);
+
+    double start = benchNow();
+    compile(source, &chunk);
+    double end = benchNow();
+
+    printf("large  %zu bytes of source, %d bytecode bytes: %8.3f ms, %8.1f MB/s\n",
+        length, chunk.count, (end - start) * 1e3, length / (end - start) / (1024 * 1024));
+
+    freeChunk(&chunk);
+    freeVM();
+    free(source);
+}
+
+void benchCompile() {
+    generateSources();
+    compileAll(false);
+    compileAll(true);
+    compileLarge();
+}
@@ -0,0 +1,89 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+#define FLAT_PIECES 2000
+#define DEEP_NESTING 20000
+#define ROUNDS 2000
+
+// Long but shallow: the stack never goes over a few values, so this is all dispatch and push/pop
+static char* flatSource() {
+    static const char* piece = "!(true == false) == (nil == nil) == !!(false == !true) == ";
+    size_t pieceLength = strlen(piece);
+    char* source = malloc(pieceLength * FLAT_PIECES + 8);
+    size_t length = 0;
+    for (int i = 0; i < FLAT_PIECES; i++) {
+        memcpy(source + length, piece, pieceLength);
+        length += pieceLength;
+    }
+    memcpy(source + length, "true", 5);
+    return source;
+}
+
+// true == (false == (true == (... nil))): every level keeps one more value on the stack
+static char* deepSource() {
+    char* source = malloc((size_t)DEEP_NESTING * 16 + 8);
+    size_t length = 0;
+    for (int i = 0; i < DEEP_NESTING; i++) {
+        const char* level = i % 2 == 0 ? "true == (" : "false == (";
+        memcpy(source + length, level, strlen(level));
+        length += strlen(level);
+    }
+    memcpy(source + length, "nil", 3);
+    length += 3;
+    memset(source + length, ')', DEEP_NESTING);
+    length += DEEP_NESTING;
+    source[length] = '\0';
+    return source;
+}
+
+static void runSource(const char* name, const char* source, OutputSink* sink) {
+    Chunk chunk;
+    initChunk(&chunk);
+    compile(source, &chunk);
+    int instructions = 0;
+    for (int offset = 0; offset < chunk.count; offset += 1 + opOperandCount(chunk.code[offset])) instructions++;
+
+    // compiled once, so we time only the dispatch loop
+    InterpretResult result = INTERPRET_OK;
+    double start = benchNow();
+    for (int round = 0; round < ROUNDS && result == INTERPRET_OK; round++) {
+        result = interpretChunk(&chunk);
+        resetCapturedOutput(sink);
+    }
+    double end = benchNow();
+
+    printf("%-5s %6d instructions, max stack %5d: %s, %6.2f ns/instruction\n",
+        name, instructions, chunk.maxStack, result == INTERPRET_OK ? "ok" : "FAILED",
+        (end - start) / ((double)instructions * ROUNDS) * 1e9);
+    freeChunk(&chunk);
+}
+
+void benchDispatch() {
+    initVM();
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+
+    char* flat = flatSource();
+    char* deep = deepSource();
+    runSource("flat", flat, sink);
+    runSource("deep", deep, sink);
+    free(flat);
+    free(deep);
+
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
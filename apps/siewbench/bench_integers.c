@@ -0,0 +1,136 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+// for strdup
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+#define TERMS 2000
+#define ROUNDS 5000
+
+// Integer-heavy shapes: counting, index arithmetic, comparisons, and products big enough to leave int32.
+// Each one uses a single kind of literal (all OP_SMALL_INT, or all OP_INT), so both versions dispatch the
+// same sequence of opcodes and the difference is only in what the opcodes do.
+static char* integerSource(int shape) {
+    char* source = malloc((size_t)TERMS * 48 + 8);
+    size_t length = 0;
+    for (int i = 0; i < TERMS; i++) {
+        switch (shape) {
+            case 0: length += (size_t)sprintf(source + length, "1 + "); break;
+            case 1: length += (size_t)sprintf(source + length, "%d * %d - %d + ", i % 97, i % 13, i % 100); break;
+            case 2: length += (size_t)sprintf(source + length, "(%d < %d) == (%d > %d) == ", i % 7, i % 5, i % 100, i % 11); break;
+            default: length += (size_t)sprintf(source + length, "%d * 46341 * %d - ", i % 1000 + 1000, i % 40000 + 1000); break;
+        }
+    }
+    sprintf(source + length, shape == 2 ? "true" : "0");
+    return source;
+}
+
+// The same code with every number a double, like before ints existed
+static void toDoubles(Chunk* from, Chunk* to) {
+    initChunk(to);
+    to->backend = from->backend;
+    if (from->backend == BACKEND_REGISTER) {
+        for (int i = 0; i < from->count; i++) writeChunk(to, from->code[i], from->lines[i]);
+        for (int i = 0; i < from->constants.count; i++) {
+            Value value = from->constants.values[i];
+            addConstant(to, IS_INT(value) ? NUMBER_VAL(AS_INT(value)) : value);
+        }
+        to->maxStack = from->maxStack;
+        return;
+    }
+
+    for (int offset = 0; offset < from->count; offset += 1 + opOperandCount(from->code[offset])) {
+        uint8_t instruction = from->code[offset];
+        int line = from->lines[offset];
+        if (instruction == OP_SMALL_INT || instruction == OP_INT) {
+            double value = instruction == OP_SMALL_INT
+                ? (int8_t)from->code[offset + 1]
+                : readInlineInt(from->code + offset + 1);
+            uint8_t bytes[sizeof(double)];
+            memcpy(bytes, &value, sizeof(double));
+            writeChunk(to, OP_NUMBER, line);
+            for (size_t i = 0; i < sizeof(double); i++) writeChunk(to, bytes[i], line);
+            continue;
+        }
+        for (int i = 0; i <= opOperandCount(instruction); i++) writeChunk(to, from->code[offset + i], line);
+    }
+    for (int i = 0; i < from->constants.count; i++) addConstant(to, from->constants.values[i]);
+    to->maxStack = from->maxStack;
+}
+
+static double timeChunk(Chunk* chunk, OutputSink* sink, bool* ok) {
+    double start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        if (interpretChunk(chunk) != INTERPRET_OK) *ok = false;
+        resetCapturedOutput(sink);
+    }
+    return benchNow() - start;
+}
+
+static void runIntegers(const char* name, int shape, Backend backend, OutputSink* sink) {
+    char* source = integerSource(shape);
+    Chunk ints;
+    initChunk(&ints);
+    ints.backend = backend;
+    compile(source, &ints);
+    Chunk doubles;
+    toDoubles(&ints, &doubles);
+
+    uint64_t before = vm.stats.instructions;
+    bool ok = interpretChunk(&doubles) == INTERPRET_OK;
+    uint64_t instructions = vm.stats.instructions - before;
+    char* expected = strdup(capturedOutput(sink, NULL));
+    resetCapturedOutput(sink);
+    // every observable result has to be the same, ints or not
+    ok = interpretChunk(&ints) == INTERPRET_OK && ok;
+    if (strcmp(expected, capturedOutput(sink, NULL)) != 0) ok = false;
+    resetCapturedOutput(sink);
+
+    // warm up both first, so neither gets a colder cache
+    timeChunk(&doubles, sink, &ok);
+    timeChunk(&ints, sink, &ok);
+    double doubleTime = timeChunk(&doubles, sink, &ok);
+    double intTime = timeChunk(&ints, sink, &ok);
+
+    double perInstruction = 1e9 / ((double)instructions * ROUNDS);
+    printf("%-12s %-8s %6llu instructions: doubles %6.2f ns/instruction, ints %6.2f ns/instruction, %.2fx%s\n",
+        name, backend == BACKEND_REGISTER ? "register" : "stack", (unsigned long long)instructions,
+        doubleTime * perInstruction, intTime * perInstruction, doubleTime / intTime, ok ? "" : "  OUTPUT DIFFERS!");
+    if (!ok) benchRegressed = true;
+
+    free(expected);
+    freeChunk(&doubles);
+    freeChunk(&ints);
+    free(source);
+}
+
+// The integer fast path against the same programs with every number a double (what the VM did before ints).
+// The output has to match byte for byte, the time is what the ints save.
+void benchIntegers() {
+    static const char* names[] = {"counting", "arithmetic", "comparisons", "overflow"};
+    initVM();
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+
+    for (int shape = 0; shape < 4; shape++) {
+        runIntegers(names[shape], shape, BACKEND_STACK, sink);
+        runIntegers(names[shape], shape, BACKEND_REGISTER, sink);
+    }
+
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
@@ -0,0 +1,78 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/memory.h"
+#include "siew/object.h"
+#include "siew/vm.h"
+
+#define STRING_COUNT 1000000
+
+static const char* policyName(InternPolicy policy) {
+    return policy == INTERN_EAGER ? "eager" : "lazy";
+}
+
+// builds a heap string the way the VM does at runtime, so takeString can own it
+static ObjString* runtimeString(int n) {
+    char buffer[32];
+    int length = snprintf(buffer, sizeof(buffer), "runtime-string-%d", n);
+    char* chars = ALLOCATE(char, length + 1);
+    memcpy(chars, buffer, length + 1);
+    return takeString(chars, length);
+}
+
+// strings that are created and never looked at again: printed, passed through...
+static void passThrough(InternPolicy policy, int distinct) {
+    initVM();
+    vm.internPolicy = policy;
+
+    double start = benchNow();
+    for (int i = 0; i < STRING_COUNT; i++) {
+        runtimeString(i % distinct);
+    }
+    double end = benchNow();
+
+    printf("%-5s create %d strings (%7d distinct): %8.3f ms, intern table %d entries\n",
+        policyName(policy), STRING_COUNT, distinct, (end - start) * 1e3, vm.strings.count);
+    freeVM();
+}
+
+// the worst case for the lazy policy: the same strings compared over and over
+static void equality(InternPolicy policy) {
+    initVM();
+    vm.internPolicy = policy;
+
+    ObjString* left[1000];
+    ObjString* right[1000];
+    for (int i = 0; i < 1000; i++) {
+        left[i] = runtimeString(i);
+        right[i] = runtimeString(i);
+    }
+
+    int equal = 0;
+    double start = benchNow();
+    for (int round = 0; round < 1000; round++) {
+        for (int i = 0; i < 1000; i++) {
+            if (valuesEqual(OBJ_VAL(left[i]), OBJ_VAL(right[(i + round) % 1000]))) equal++;
+        }
+    }
+    double end = benchNow();
+
+    printf("%-5s 1000000 string comparisons (%d equal): %8.3f ms\n",
+        policyName(policy), equal, (end - start) * 1e3);
+    freeVM();
+}
+
+void benchIntern() {
+    passThrough(INTERN_EAGER, STRING_COUNT);
+    passThrough(INTERN_LAZY, STRING_COUNT);
+    passThrough(INTERN_EAGER, 1000);
+    passThrough(INTERN_LAZY, 1000);
+
+    equality(INTERN_EAGER);
+    equality(INTERN_LAZY);
+}
@@ -0,0 +1,136 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+// for strdup
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+#define LITERALS 200 // the pool version needs one constant per literal, and OP_CONSTANT can't go over 256
+#define ROUNDS 20000
+#define MANY_LITERALS 5000
+
+// 1 + 2 - 3 + 4 ... (or with decimals): nothing but literals and the arithmetic between them
+static char* literalSource(int count, bool decimals) {
+    char* source = malloc((size_t)count * 16 + 8);
+    size_t length = 0;
+    for (int i = 0; i < count; i++) {
+        const char* op = i == 0 ? "" : i % 2 == 0 ? " + " : " - ";
+        if (decimals) {
+            length += (size_t)sprintf(source + length, "%s%d.25", op, i % 1000);
+        } else {
+            length += (size_t)sprintf(source + length, "%s%d", op, i % 100);
+        }
+    }
+    source[length] = '\0';
+    return source;
+}
+
+// The same code, as the compiler used to write it: every number loaded from the constants
+static void toConstantPool(Chunk* from, Chunk* to) {
+    initChunk(to);
+    for (int offset = 0; offset < from->count; offset += 1 + opOperandCount(from->code[offset])) {
+        uint8_t instruction = from->code[offset];
+        int line = from->lines[offset];
+        if (instruction == OP_SMALL_INT || instruction == OP_NUMBER) {
+            double value = instruction == OP_SMALL_INT
+                ? (int8_t)from->code[offset + 1]
+                : readInlineNumber(from->code + offset + 1);
+            writeChunk(to, OP_CONSTANT, line);
+            writeChunk(to, (uint8_t)addConstant(to, NUMBER_VAL(value)), line);
+            continue;
+        }
+        for (int i = 0; i <= opOperandCount(instruction); i++) writeChunk(to, from->code[offset + i], line);
+    }
+    to->maxStack = from->maxStack;
+}
+
+static double timeChunk(Chunk* chunk, OutputSink* sink, bool* ok) {
+    double start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        if (interpretChunk(chunk) != INTERPRET_OK) *ok = false;
+        resetCapturedOutput(sink);
+    }
+    return benchNow() - start;
+}
+
+static void runLiterals(const char* name, bool decimals, OutputSink* sink) {
+    char* source = literalSource(LITERALS, decimals);
+    Chunk immediate;
+    initChunk(&immediate);
+    compile(source, &immediate);
+    Chunk pool;
+    toConstantPool(&immediate, &pool);
+
+    int instructions = 0;
+    for (int offset = 0; offset < immediate.count; offset += 1 + opOperandCount(immediate.code[offset])) instructions++;
+
+    // warm up both first, so neither gets a colder cache
+    bool ok = true;
+    timeChunk(&pool, sink, &ok);
+    timeChunk(&immediate, sink, &ok);
+    double poolTime = timeChunk(&pool, sink, &ok);
+    double immediateTime = timeChunk(&immediate, sink, &ok);
+
+    // the same program has to print the same thing both ways
+    interpretChunk(&pool);
+    char* expected = strdup(capturedOutput(sink, NULL));
+    resetCapturedOutput(sink);
+    interpretChunk(&immediate);
+    if (strcmp(expected, capturedOutput(sink, NULL)) != 0) ok = false;
+    resetCapturedOutput(sink);
+    free(expected);
+
+    double perInstruction = 1e9 / ((double)instructions * ROUNDS);
+    printf("%-10s %-9s %5d code bytes, %3d constants: %6.2f ns/instruction\n",
+        name, "pool", pool.count, pool.constants.count, poolTime * perInstruction);
+    printf("%-10s %-9s %5d code bytes, %3d constants: %6.2f ns/instruction, %.2fx%s\n",
+        name, "immediate", immediate.count, immediate.constants.count, immediateTime * perInstruction,
+        poolTime / immediateTime, ok ? "" : "  FAILED");
+    if (!ok) benchRegressed = true;
+
+    freeChunk(&pool);
+    freeChunk(&immediate);
+    free(source);
+}
+
+// more number literals than OP_CONSTANT could ever address, which used to be a compile error
+static void runManyLiterals(OutputSink* sink) {
+    char* source = literalSource(MANY_LITERALS, true);
+    Chunk chunk;
+    initChunk(&chunk);
+    bool compiled = compile(source, &chunk);
+    bool ran = compiled && interpretChunk(&chunk) == INTERPRET_OK;
+    resetCapturedOutput(sink);
+
+    printf("%d literals in one chunk: %s, %d constants\n",
+        MANY_LITERALS, ran ? "ok" : "FAILED", chunk.constants.count);
+    if (!ran) benchRegressed = true;
+    freeChunk(&chunk);
+    free(source);
+}
+
+void benchLiterals() {
+    initVM();
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+
+    runLiterals("small ints", false, sink);
+    runLiterals("decimals", true, sink);
+    runManyLiterals(sink);
+
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
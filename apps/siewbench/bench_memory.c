@@ -0,0 +1,80 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+#define HEAP_LIMIT (256 * 1024)
+#define PIECE_SIZE 4000
+#define PIECES 200
+#define RUNS 2000
+
+// "xxxx...x" + "xxxx...x" + ... : 200 pieces of 4000 chars, about 800 KB once printed.
+// The literals are all the same, so they are interned only once. The script is cheap to compile,
+// its result is what doesn't fit in the heap.
+static char* adversarialSource() {
+    size_t size = (size_t)PIECES * (PIECE_SIZE + 5) + 1;
+    char* source = malloc(size);
+    size_t length = 0;
+    for (int i = 0; i < PIECES; i++) {
+        if (i > 0) length += (size_t)snprintf(source + length, size - length, " + ");
+        source[length++] = '"';
+        memset(source + length, 'x', PIECE_SIZE);
+        length += PIECE_SIZE;
+        source[length++] = '"';
+    }
+    source[length] = '\0';
+    return source;
+}
+
+// A tenant that keeps concatenating under a small heap limit. The VM must refuse with a runtime error
+// (not exit the process), stay under the limit, and keep working for the next script.
+void benchMemory() {
+    initVM();
+    vm.heapLimit = HEAP_LIMIT;
+    // what the scripts print (a "false" each) is not the report
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+    bool ok = true;
+
+    char* source = adversarialSource();
+    double start = benchNow();
+    InterpretResult result = interpret(source);
+    double end = benchNow();
+    free(source);
+
+    printf("adversarial concatenation under a %d KB limit: %s in %.3f ms, heap now %zu bytes\n",
+        HEAP_LIMIT / 1024, result == INTERPRET_RUNTIME_ERROR ? "runtime error" : "NOT STOPPED",
+        (end - start) * 1e3, vm.bytesAllocated);
+    if (result != INTERPRET_RUNTIME_ERROR || vm.bytesAllocated > HEAP_LIMIT) ok = false;
+
+    // now lots of small scripts: their garbage must be collected when we reach the limit
+    size_t peak = 0;
+    start = benchNow();
+    for (int i = 0; i < RUNS && ok; i++) {
+        char script[128];
+        snprintf(script, sizeof(script), "\"run %d \" + \"of \" + \"many \" + \"small \" + \"scripts\" == \"nope\"", i);
+        if (interpret(script) != INTERPRET_OK) ok = false;
+        resetCapturedOutput(sink);
+        if (vm.bytesAllocated > peak) peak = vm.bytesAllocated;
+    }
+    end = benchNow();
+
+    printf("%d small scripts under the same limit: %.3f ms, peak heap %zu bytes\n", RUNS, (end - start) * 1e3, peak);
+    if (peak > HEAP_LIMIT) ok = false;
+
+    printf("memory limit: %s\n", ok ? "ok" : "FAILED");
+    if (!ok) benchRegressed = true;
+
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
@@ -0,0 +1,207 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/number.h"
+
+#define LITERAL_COUNT 1000000
+#define LITERAL_SIZE 48
+#define ROUNDS 5
+
+// xorshift, so every run checks the same numbers
+static uint64_t state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t nextRandom() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+static uint64_t bitsOf(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// a literal the scanner could give us: up to 25 digits, maybe a '.' somewhere
+static int randomLiteral(char* buffer) {
+    int digits = 1 + (int)(nextRandom() % 25);
+    int point = (int)(nextRandom() % (digits + 1));
+    int length = 0;
+    for (int i = 0; i < digits; i++) {
+        if (i == point && i > 0) buffer[length++] = '.';
+        buffer[length++] = (char)('0' + nextRandom() % 10);
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+// literals that sit on the edges: halfway between two doubles, subnormals, overflow, long runs of zeros
+static void checkParseEdges(int* failures) {
+    static const char* edges[] = {
+        "0", "0.0", "1", "9007199254740992", "9007199254740993", "9007199254740995",
+        "0.1", "0.3", "123456789012345678901234567890",
+        "179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368",
+        "0.5000000000000000277555756156289135105907917022705078125",
+        "2.2250738585072011", "2.2250738585072014", "4.9406564584124654",
+        "1797693134862315708145274237317043567981",
+        "3.141592653589793238462643383279502884197169399375105820974944592307816406286",
+    };
+
+    for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+        double expected = strtod(edges[i], NULL);
+        if (bitsOf(parseNumber(edges[i], (int)strlen(edges[i]))) != bitsOf(expected)) {
+            printf("  parse mismatch: %s\n", edges[i]);
+            (*failures)++;
+        }
+    }
+
+    // the same digits behind more and more zeros, down through the subnormals and past the smallest one
+    char buffer[400];
+    for (int zeros = 1; zeros < 340; zeros += 7) {
+        memcpy(buffer, "0.", 2);
+        memset(buffer + 2, '0', zeros);
+        memcpy(buffer + 2 + zeros, "49406564584124654", 18);
+        double expected = strtod(buffer, NULL);
+        if (bitsOf(parseNumber(buffer, (int)strlen(buffer))) != bitsOf(expected)) {
+            printf("  parse mismatch: 0.[%d zeros]49406564584124654\n", zeros);
+            (*failures)++;
+        }
+    }
+}
+
+static void checkCorrectness() {
+    int parseFailures = 0;
+    char literal[LITERAL_SIZE];
+    for (int i = 0; i < LITERAL_COUNT; i++) {
+        int length = randomLiteral(literal);
+        if (bitsOf(parseNumber(literal, length)) != bitsOf(strtod(literal, NULL))) {
+            if (parseFailures < 10) printf("  parse mismatch: %s\n", literal);
+            parseFailures++;
+        }
+    }
+    checkParseEdges(&parseFailures);
+
+    // every finite double must read back as itself, and be as short as the shortest %.*g that does
+    int formatFailures = 0;
+    int longer = 0;
+    char text[NUMBER_BUFFER_SIZE];
+    for (int i = 0; i < LITERAL_COUNT; i++) {
+        uint64_t bits = nextRandom();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if (value != value || value - value != 0) continue; // nan, inf
+
+        formatNumber(value, text);
+        if (bitsOf(strtod(text, NULL)) != bitsOf(value)) {
+            if (formatFailures < 10) printf("  format mismatch: %s for %.17g\n", text, value);
+            formatFailures++;
+            continue;
+        }
+
+        // significant digits: from the first nonzero one to the last nonzero one, before the exponent
+        int significant = 0;
+        int pending = 0;
+        for (const char* c = text; *c != '\0' && *c != 'e'; c++) {
+            if (*c < '0' || *c > '9') continue;
+            if (*c != '0') {
+                significant += pending + 1;
+                pending = 0;
+            } else if (significant > 0) {
+                pending++;
+            }
+        }
+
+        char shortest[40];
+        for (int precision = 1; precision <= 17; precision++) {
+            snprintf(shortest, sizeof(shortest), "%.*g", precision, value);
+            if (bitsOf(strtod(shortest, NULL)) == bitsOf(value)) {
+                if (significant > precision) longer++;
+                break;
+            }
+        }
+    }
+
+    printf("check  %d literals: %d parse mismatches vs strtod\n", LITERAL_COUNT, parseFailures);
+    printf("check  %d doubles: %d do not round-trip, %d longer than the shortest %%.*g\n",
+        LITERAL_COUNT, formatFailures, longer);
+    // these are the parser's and the formatter's tests, a mismatch (or a digit more than needed) fails the run
+    if (parseFailures > 0 || formatFailures > 0 || longer > 0) benchRegressed = true;
+}
+
+static void benchParse(char (*literals)[LITERAL_SIZE], int* lengths) {
+    double sum = 0;
+    double start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < LITERAL_COUNT; i++) sum += strtod(literals[i], NULL);
+    }
+    double libc = benchNow() - start;
+
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < LITERAL_COUNT; i++) sum += parseNumber(literals[i], lengths[i]);
+    }
+    double ours = benchNow() - start;
+
+    double total = (double)LITERAL_COUNT * ROUNDS;
+    printf("parse  strtod      %8.3f ms, %6.1f M literals/s\n", libc * 1e3, total / libc / 1e6);
+    printf("parse  parseNumber %8.3f ms, %6.1f M literals/s (%.2fx)  [%g]\n",
+        ours * 1e3, total / ours / 1e6, libc / ours, sum);
+}
+
+static void benchFormat(const double* values) {
+    char text[40];
+    size_t bytes = 0;
+
+    double start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < LITERAL_COUNT; i++) bytes += (size_t)snprintf(text, sizeof(text), "%g", values[i]);
+    }
+    double shortG = benchNow() - start;
+
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < LITERAL_COUNT; i++) bytes += (size_t)snprintf(text, sizeof(text), "%.17g", values[i]);
+    }
+    double longG = benchNow() - start;
+
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < LITERAL_COUNT; i++) bytes += (size_t)formatNumber(values[i], text);
+    }
+    double ours = benchNow() - start;
+
+    double total = (double)LITERAL_COUNT * ROUNDS;
+    printf("format %%g (lossy)   %8.3f ms, %6.1f M numbers/s\n", shortG * 1e3, total / shortG / 1e6);
+    printf("format %%.17g        %8.3f ms, %6.1f M numbers/s\n", longG * 1e3, total / longG / 1e6);
+    printf("format formatNumber %8.3f ms, %6.1f M numbers/s (%.2fx vs %%g)  [%zu]\n",
+        ours * 1e3, total / ours / 1e6, shortG / ours, bytes);
+}
+
+void benchNumber() {
+    checkCorrectness();
+
+    char (*literals)[LITERAL_SIZE] = malloc(sizeof(*literals) * LITERAL_COUNT);
+    int* lengths = malloc(sizeof(int) * LITERAL_COUNT);
+    double* values = malloc(sizeof(double) * LITERAL_COUNT);
+    for (int i = 0; i < LITERAL_COUNT; i++) {
+        lengths[i] = randomLiteral(literals[i]);
+        // the kind of numbers our data scripts print: prices, ratios, counters
+        values[i] = i % 3 == 0 ? (double)(nextRandom() % 100000) / 100
+                  : i % 3 == 1 ? (double)(nextRandom() % 1000000)
+                  : strtod(literals[i], NULL);
+    }
+
+    benchParse(literals, lengths);
+    benchFormat(values);
+
+    free(literals);
+    free(lengths);
+    free(values);
+}
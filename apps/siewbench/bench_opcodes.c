@@ -0,0 +1,100 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+#define REPEATS 10000
+#define ROUNDS 1000
+
+// Each case is a chunk written by hand: the prologue once, then the body REPEATS times, then OP_RETURN.
+// The body leaves the stack as it found it, and focuses on one opcode (pushes need something to consume them).
+typedef struct {
+    const char* name;
+    uint8_t prologue[4];
+    int prologueLength;
+    uint8_t body[8];
+    int bodyLength;
+    int bodyInstructions;
+} OpcodeCase;
+
+// constant 0 is 1.5, constant 1 is 1 (so multiplying and dividing never reach subnormals)
+static const OpcodeCase cases[] = {
+    {"OP_NOT", {OP_TRUE}, 1, {OP_NOT}, 1, 1},
+    {"OP_NEGATE", {OP_CONSTANT, 0}, 2, {OP_NEGATE}, 1, 1},
+    {"OP_CONSTANT + OP_ADD", {OP_CONSTANT, 0}, 2, {OP_CONSTANT, 1, OP_ADD}, 3, 2},
+    {"OP_CONSTANT + OP_SUBTRACT", {OP_CONSTANT, 0}, 2, {OP_CONSTANT, 1, OP_SUBTRACT}, 3, 2},
+    {"OP_CONSTANT + OP_MULTIPLY", {OP_CONSTANT, 0}, 2, {OP_CONSTANT, 1, OP_MULTIPLY}, 3, 2},
+    {"OP_CONSTANT + OP_DIVIDE", {OP_CONSTANT, 0}, 2, {OP_CONSTANT, 1, OP_DIVIDE}, 3, 2},
+    {"OP_LESS (+ 2 consts, equal)", {OP_TRUE}, 1, {OP_CONSTANT, 0, OP_CONSTANT, 1, OP_LESS, OP_EQUAL}, 6, 4},
+    {"OP_GREATER (+ 2 consts, equal)", {OP_TRUE}, 1, {OP_CONSTANT, 0, OP_CONSTANT, 1, OP_GREATER, OP_EQUAL}, 6, 4},
+    {"OP_CONSTANT + OP_EQUAL", {OP_CONSTANT, 0}, 2, {OP_CONSTANT, 1, OP_EQUAL}, 3, 2},
+    {"OP_NIL + OP_EQUAL", {OP_NIL}, 1, {OP_NIL, OP_EQUAL}, 2, 2},
+    {"OP_TRUE + OP_EQUAL", {OP_TRUE}, 1, {OP_TRUE, OP_EQUAL}, 2, 2},
+    {"OP_FALSE + OP_EQUAL", {OP_FALSE}, 1, {OP_FALSE, OP_EQUAL}, 2, 2},
+};
+
+#define CASE_COUNT (int)(sizeof(cases) / sizeof(cases[0]))
+
+static void buildChunk(Chunk* chunk, const OpcodeCase* opcodeCase) {
+    initChunk(chunk);
+    addConstant(chunk, NUMBER_VAL(1.5));
+    addConstant(chunk, NUMBER_VAL(1));
+
+    for (int i = 0; i < opcodeCase->prologueLength; i++) writeChunk(chunk, opcodeCase->prologue[i], 1);
+    for (int repeat = 0; repeat < REPEATS; repeat++) {
+        for (int i = 0; i < opcodeCase->bodyLength; i++) writeChunk(chunk, opcodeCase->body[i], 1);
+    }
+    writeChunk(chunk, OP_RETURN, 1);
+
+    // nobody computed it for us, the verifier checks we are right
+    chunk->maxStack = 3;
+}
+
+static double timeChunk(Chunk* chunk, bool cached, OutputSink* sink, bool* ok) {
+    setRegisterCaching(cached);
+
+    double start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        if (interpretChunk(chunk) != INTERPRET_OK) *ok = false;
+        resetCapturedOutput(sink);
+    }
+    return benchNow() - start;
+}
+
+void benchOpcodes() {
+    initVM();
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+
+    printf("%-32s %12s %12s %8s\n", "ns per instruction", "vm.stackTop", "registers", "gain");
+    for (int i = 0; i < CASE_COUNT; i++) {
+        Chunk chunk;
+        buildChunk(&chunk, &cases[i]);
+
+        // warm up, and alternate so neither mode gets a warmer cache
+        bool ok = true;
+        timeChunk(&chunk, true, sink, &ok);
+        double stack = timeChunk(&chunk, false, sink, &ok);
+        double cached = timeChunk(&chunk, true, sink, &ok);
+
+        double instructions = (double)cases[i].bodyInstructions * REPEATS * ROUNDS;
+        printf("%-32s %12.3f %12.3f %7.2fx%s\n", cases[i].name,
+            stack / instructions * 1e9, cached / instructions * 1e9, stack / cached, ok ? "" : "  FAILED");
+        if (!ok) benchRegressed = true;
+        freeChunk(&chunk);
+    }
+
+    setRegisterCaching(true);
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
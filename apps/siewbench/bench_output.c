@@ -0,0 +1,108 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/object.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+#define VALUE_COUNT 1000000
+#define OUTPUT_PATH "siew_bench_output.txt"
+
+static Value values[VALUE_COUNT];
+
+// what a data script prints: mostly numbers, some strings and booleans
+static void generateValues() {
+    static const char* words[] = {"ok", "pending", "customer_balance", "a much longer status line for the report"};
+    for (int i = 0; i < VALUE_COUNT; i++) {
+        switch (i % 4) {
+            case 0: values[i] = NUMBER_VAL(i / 100.0); break;
+            case 1: values[i] = NUMBER_VAL(i); break;
+            case 2: {
+                const char* word = words[i % 16 / 4];
+                values[i] = OBJ_VAL(copyString(word, (int)strlen(word)));
+                break;
+            }
+            default: values[i] = BOOL_VAL(i % 8 == 3); break;
+        }
+    }
+}
+
+// how printValue used to do it: one printf per fragment, straight into stdio
+static void printfValue(FILE* file, Value value) {
+    switch (value.type) {
+        case VAL_BOOL: fprintf(file, AS_BOOL(value) ? "true" : "false"); break;
+        case VAL_NIL: fprintf(file, "nil"); break;
+        case VAL_NUMBER: fprintf(file, "%g", AS_NUMBER(value)); break;
+        case VAL_INT: fprintf(file, "%d", AS_INT(value)); break;
+        case VAL_OBJ: fprintf(file, "%s", AS_CSTRING(value)); break;
+    }
+    fprintf(file, "\n");
+}
+
+static void runPrintf(const char* name, int mode) {
+    FILE* file = fopen(OUTPUT_PATH, "wb");
+    // a terminal is line buffered: every value is a write() system call
+    setvbuf(file, NULL, mode, BUFSIZ);
+
+    double start = benchNow();
+    for (int i = 0; i < VALUE_COUNT; i++) printfValue(file, values[i]);
+    fflush(file);
+    double end = benchNow();
+    long size = ftell(file);
+    fclose(file);
+
+    printf("%-26s %8.3f ms, %6.1f M values/s, %ld bytes\n", name, (end - start) * 1e3, VALUE_COUNT / (end - start) / 1e6, size);
+}
+
+static void runSink(const char* name, OutputSink* sink) {
+    setOutputSink(sink);
+
+    double start = benchNow();
+    for (int i = 0; i < VALUE_COUNT; i++) {
+        printValue(values[i]);
+        writeOutput(vm.output, "\n", 1);
+    }
+    flushOutput(sink);
+    double end = benchNow();
+
+    size_t size = 0;
+    if (sink->file != NULL) {
+        // the sink writes around stdio, so the FILE's own position knows nothing
+        fseek(sink->file, 0, SEEK_END);
+        size = (size_t)ftell(sink->file);
+    } else {
+        capturedOutput(sink, &size);
+    }
+
+    printf("%-26s %8.3f ms, %6.1f M values/s, %zu bytes\n", name, (end - start) * 1e3, VALUE_COUNT / (end - start) / 1e6, size);
+    setOutputSink(NULL);
+}
+
+void benchOutput() {
+    initVM();
+    generateValues();
+
+    runPrintf("printf, line buffered", _IOLBF);
+    runPrintf("printf, fully buffered", _IOFBF);
+
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    FILE* file = fopen(OUTPUT_PATH, "wb");
+    initFileSink(sink, file);
+    runSink("sink -> file", sink);
+    freeOutputSink(sink);
+    fclose(file);
+
+    initCaptureSink(sink);
+    runSink("sink -> capture", sink);
+    freeOutputSink(sink);
+
+    free(sink);
+    remove(OUTPUT_PATH);
+    freeVM();
+}
@@ -0,0 +1,93 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/scanner.h"
+
+#define CORPUS_SIZE (32 * 1024 * 1024)
+#define ROUNDS 5
+
+// Looks like the generated scripts we get: indentation, long identifiers, numbers, strings and comments.
+static char* generateCorpus() {
+    char* source = malloc(CORPUS_SIZE + 256);
+    size_t length = 0;
+    for (int i = 0; length < CORPUS_SIZE; i++) {
+        length += (size_t)snprintf(source + length, 256,
+            "        // generated record %d, keep in sync with the exporter\n"
+            "        var customer_balance_%d = previous_balance_total + %d.%d * exchange_rate;\n"
+            "        print \"record %d of the export, with a long enough description\";\n\n",
+            i, i, i, i % 100, i);
+    }
+    source[length] = '\0';
+    return source;
+}
+
+static void scanAll(const char* source, size_t length, bool vectorized) {
+    setScannerVectorized(vectorized);
+
+    int tokens = 0;
+    int lastLine = 0;
+    double start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        initScanner(source);
+        tokens = 0;
+        for (;;) {
+            Token token = scanToken();
+            tokens++;
+            if (token.type == TOKEN_EOF) {
+                lastLine = token.line;
+                break;
+            }
+        }
+    }
+    double end = benchNow();
+
+    double seconds = (end - start) / ROUNDS;
+    printf("%-6s %zu bytes, %d tokens, %d lines: %8.1f MB/s, %6.1f Mtokens/s\n",
+        vectorized ? "simd" : "scalar", length, tokens, lastLine,
+        length / seconds / (1024 * 1024), tokens / seconds / 1e6);
+}
+
+// Almost nothing but identifiers and keywords: this is where identifierType() matters, and where the SIMD mode
+// must not lose to the scalar one on short runs.
+static char* generateIdentifierCorpus() {
+    static const char* words[] = {
+        "and", "class", "else", "false", "for", "fun", "if", "nil", "or", "print", "return", "super",
+        "this", "true", "var", "while", "fn", "iffy", "classy", "total", "x", "customer", "forEach",
+        "printer", "nilable", "truely", "balance_2", "returnValue", "superb", "th", "whilst", "v",
+    };
+    int wordCount = (int)(sizeof(words) / sizeof(words[0]));
+
+    char* source = malloc(CORPUS_SIZE + 64);
+    size_t length = 0;
+    for (int i = 0; length < CORPUS_SIZE; i++) {
+        length += (size_t)snprintf(source + length, 64, "%s%c", words[(i * 7) % wordCount], i % 16 == 15 ? '\n' : ' ');
+    }
+    source[length] = '\0';
+    return source;
+}
+
+void benchScanner() {
+    char* source = generateCorpus();
+    size_t length = strlen(source);
+
+    scanAll(source, length, false);
+    scanAll(source, length, true);
+
+    free(source);
+
+    printf("identifier-dense corpus:\n");
+    source = generateIdentifierCorpus();
+    length = strlen(source);
+
+    scanAll(source, length, false);
+    scanAll(source, length, true);
+
+    setScannerVectorized(true);
+    free(source);
+}
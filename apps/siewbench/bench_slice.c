@@ -0,0 +1,72 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/memory.h"
+#include "siew/object.h"
+#include "siew/vm.h"
+
+#define BUFFER_SIZE (64 * 1024 * 1024)
+
+// Something that looks like a log file: lines of different lengths, each one a "record".
+static ObjString* makeLog() {
+    char* chars = ALLOCATE(char, BUFFER_SIZE + 1);
+    int length = 0;
+    for (int line = 0; length < BUFFER_SIZE - 128; line++) {
+        length += snprintf(chars + length, 128, "2026-10-18T12:00:%02d INFO request %d served in %d ms\n",
+            line % 60, line, line % 997);
+    }
+    chars[length] = '\0';
+    return takeString(chars, length);
+}
+
+// We cut every line out of the buffer, and then every field of every line (slicing a slice).
+static void sliceLines(bool useSlices) {
+    initVM();
+    vm.internPolicy = INTERN_LAZY;
+    ObjString* log = makeLog();
+    const char* chars = stringChars(log);
+
+    int lines = 0;
+    double start = benchNow();
+    int lineStart = 0;
+    for (int i = 0; i < log->length; i++) {
+        if (chars[i] != '\n') continue;
+
+        int lineLength = i - lineStart;
+        ObjString* line;
+        ObjString* level;
+        if (useSlices) {
+            line = sliceString(log, lineStart, lineLength);
+            level = sliceString(line, 20, 4);
+        } else {
+            char* copy = ALLOCATE(char, lineLength + 1);
+            memcpy(copy, chars + lineStart, lineLength);
+            copy[lineLength] = '\0';
+            line = takeString(copy, lineLength);
+
+            char* levelCopy = ALLOCATE(char, 5);
+            memcpy(levelCopy, line->chars + 20, 4);
+            levelCopy[4] = '\0';
+            level = takeString(levelCopy, 4);
+        }
+        (void)level;
+
+        lines++;
+        lineStart = i + 1;
+    }
+    double end = benchNow();
+
+    printf("%-6s %d MB buffer, %d lines + %d fields: %8.3f ms\n",
+        useSlices ? "slice" : "copy", log->length / (1024 * 1024), lines, lines, (end - start) * 1e3);
+    freeVM();
+}
+
+void benchSlice() {
+    sliceLines(false);
+    sliceLines(true);
+}
@@ -0,0 +1,148 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+// fork, mmap and getrusage, so this one is POSIX only
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/vm.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// 1 GB by default, SIEW_BENCH_STREAM_MB=<n> to change it
+#define DEFAULT_SCRIPT_MB 1024
+#define SCRIPT_PATH "siew_bench_stream.sw"
+
+typedef enum {
+    READ_BUFFERED, // what the CLI used to do: malloc the whole file and fread it
+    READ_MAPPED,
+    READ_STREAMED,
+} ReadMode;
+
+static const char* modeNames[] = {"buffered", "mmap", "stream"};
+
+// Same shape as the large compile benchmark, with the comments real generated scripts have,
+// so most of the file is source the compiler reads and throws away.
+static size_t generateScript(size_t size) {
+    static const char* piece = "!(true == false) == (nil == nil)\n"
+                               "    // generated check, the exporter keeps one comment per clause\n"
+                               "    == !!(false == !true) == ";
+    size_t pieceLength = strlen(piece);
+
+    FILE* file = fopen(SCRIPT_PATH, "wb");
+    if (file == NULL) return 0;
+
+    size_t length = 0;
+    while (length + pieceLength < size) {
+        fwrite(piece, 1, pieceLength, file);
+        length += pieceLength;
+    }
+    // an odd tail, so the mmap path gets its '\0' from the zeroed end of the last page
+    fputs("true\n", file);
+    length += 5;
+
+    fclose(file);
+    return length;
+}
+
+// runs in its own process, so the peak RSS we read at the end is only this mode's
+static void compileWith(ReadMode mode) {
+    initVM();
+    Chunk chunk;
+    initChunkInArena(&chunk, &vm.compileArena, 0);
+
+    double start = benchNow();
+    FILE* file = fopen(SCRIPT_PATH, "rb");
+    bool compiled = false;
+
+    if (mode == READ_BUFFERED) {
+        fseek(file, 0L, SEEK_END);
+        size_t size = (size_t)ftell(file);
+        rewind(file);
+        char* source = malloc(size + 1);
+        size_t read = fread(source, 1, size, file);
+        source[read] = '\0';
+        compiled = compile(source, &chunk);
+        free(source);
+    } else if (mode == READ_MAPPED) {
+        struct stat info;
+        fstat(fileno(file), &info);
+        void* mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+        posix_madvise(mapped, (size_t)info.st_size, POSIX_MADV_SEQUENTIAL);
+        compiled = compile((const char*)mapped, &chunk);
+        munmap(mapped, (size_t)info.st_size);
+    } else {
+        compiled = compileFile(file, &chunk);
+    }
+    // we don't run anything, the first instruction would execute right here
+    double end = benchNow();
+    fclose(file);
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    long peakKb = usage.ru_maxrss / 1024; // bytes on macOS
+#else
+    long peakKb = usage.ru_maxrss;
+#endif
+
+    printf("%-8s %s, %d bytecode bytes: first instruction after %9.1f ms, peak RSS %8.1f MB\n",
+        modeNames[mode], compiled ? "ok" : "error", chunk.count, (end - start) * 1e3, peakKb / 1024.0);
+    fflush(stdout);
+
+    freeChunk(&chunk);
+    freeVM();
+}
+
+void benchStream() {
+    size_t mb = DEFAULT_SCRIPT_MB;
+    const char* override = getenv("SIEW_BENCH_STREAM_MB");
+    if (override != NULL && atol(override) > 0) mb = (size_t)atol(override);
+
+    double start = benchNow();
+    size_t length = generateScript(mb * 1024 * 1024);
+    if (length == 0) {
+        fprintf(stderr, "Could not write \"%s\".\n", SCRIPT_PATH);
+        return;
+    }
+    printf("script   %zu bytes, generated in %.1f ms\n", length, (benchNow() - start) * 1e3);
+    fflush(stdout);
+
+    for (ReadMode mode = READ_BUFFERED; mode <= READ_STREAMED; mode++) {
+        // the file was just written, so every mode reads it from the page cache
+        pid_t child = fork();
+        if (child == 0) {
+            compileWith(mode);
+            _exit(0);
+        }
+
+        int status;
+        waitpid(child, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            printf("%-8s did not finish (killed, out of memory?)\n", modeNames[mode]);
+        }
+    }
+
+    remove(SCRIPT_PATH);
+}
+
+#else
+
+void benchStream() {
+    printf("stream   skipped, needs fork/mmap\n");
+}
+
+#endif
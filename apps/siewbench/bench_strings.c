@@ -0,0 +1,66 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/object.h"
+#include "siew/vm.h"
+
+#define ONE_MB (1024 * 1024)
+
+static ObjString* makePiece(int size) {
+    char piece[4096];
+    memset(piece, 'x', size);
+    return copyString(piece, size);
+}
+
+// This is what every '+' does now: glue a piece to the end with a rope node.
+// The contents are only observed once, at the very end.
+static void ropeBuild(int targetBytes, int pieceSize) {
+    initVM();
+    ObjString* piece = makePiece(pieceSize);
+    ObjString* result = copyString("", 0);
+
+    double start = benchNow();
+    while (result->length < targetBytes) {
+        result = concatenateStrings(result, piece);
+    }
+    double built = benchNow();
+    internString(result); // flatten + hash + intern, what printing or comparing would do
+    double observed = benchNow();
+
+    printf("rope   %8d bytes in %5d-byte pieces: concat %8.3f ms, observe %8.3f ms, total %8.3f ms\n",
+        result->length, pieceSize, (built - start) * 1e3, (observed - built) * 1e3, (observed - start) * 1e3);
+    freeVM();
+}
+
+// The old behaviour: every '+' copies, hashes and interns the whole string built so far.
+// Nothing is freed until freeVM (there is no GC), so we keep these sizes modest.
+static void eagerBuild(int targetBytes, int pieceSize) {
+    initVM();
+    ObjString* piece = makePiece(pieceSize);
+    ObjString* result = copyString("", 0);
+
+    double start = benchNow();
+    while (result->length < targetBytes) {
+        result = internString(concatenateStrings(result, piece));
+    }
+    double end = benchNow();
+
+    printf("eager  %8d bytes in %5d-byte pieces: total %8.3f ms\n",
+        result->length, pieceSize, (end - start) * 1e3);
+    freeVM();
+}
+
+void benchStrings() {
+    ropeBuild(ONE_MB, 1);
+    ropeBuild(ONE_MB, 16);
+    ropeBuild(ONE_MB, 256);
+    ropeBuild(ONE_MB, 4096);
+
+    eagerBuild(ONE_MB / 4, 256);
+    eagerBuild(ONE_MB, 4096);
+}
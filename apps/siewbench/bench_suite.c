@@ -0,0 +1,378 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/output.h"
+#include "siew/vm.h"
+
+// where the suite's .sw files are, the build points it to siew_bench_scripts/ (SIEW_BENCH_SCRIPTS overrides it)
+#ifndef SIEW_BENCH_SCRIPTS
+#define SIEW_BENCH_SCRIPTS "siew_bench_scripts"
+#endif
+
+#define SAMPLE_SECONDS 0.02 // a sample runs the case this long (about), so the clock's resolution doesn't matter
+#define LARGE_SOURCE_SIZE (8 * 1024 * 1024)
+#define MIN_CHANGE 0.05 // smaller differences are not worth reporting: two runs of the same build drift that much
+#define MAX_P 0.05
+
+typedef enum {
+    CASE_RUN, // interpret(): compile and run
+    CASE_COMPILE, // compile() only
+} CaseMode;
+
+typedef struct {
+    const char* name;
+    const char* script; // a file in SIEW_BENCH_SCRIPTS, or NULL when generate makes the source
+    char* (*generate)();
+    CaseMode mode;
+} SuiteCase;
+
+typedef struct {
+    int iterations; // runs of the case in each sample
+    double* samples; // seconds per run
+    double mean;
+    double stddev;
+    double median;
+    double min;
+    double max;
+    bool ok;
+} CaseResult;
+
+typedef struct {
+    bool found;
+    double mean;
+    double stddev;
+    int repetitions;
+    double change; // mean / baseline mean - 1
+    double p; // Welch's t-test, two-sided
+    const char* verdict;
+} Comparison;
+
+static char* largeSource();
+
+static const SuiteCase suite[] = {
+    {"arithmetic", "arithmetic.sw", NULL, CASE_RUN},
+    {"comparisons", "comparisons.sw", NULL, CASE_RUN},
+    {"concat", "concat.sw", NULL, CASE_RUN},
+    {"intern", "intern.sw", NULL, CASE_RUN},
+    {"large_compile", NULL, largeSource, CASE_COMPILE},
+};
+
+#define SUITE_COUNT (int)(sizeof(suite) / sizeof(suite[0]))
+
+// Too big to keep in the repository: a few MB of the compiler's usual work, repeated.
+// No strings, every string literal takes a constant slot and there are only 256 of them.
+static char* largeSource() {
+    static const char* piece = "!(1.5 * 2 < 3 - 0.25) == (nil == nil)\n    == !(true == false) == !!(10 / 4 >= 2) == ";
+    size_t pieceLength = strlen(piece);
+    char* source = malloc(LARGE_SOURCE_SIZE + 64);
+    size_t length = 0;
+    while (length + pieceLength < LARGE_SOURCE_SIZE) {
+        memcpy(source + length, piece, pieceLength);
+        length += pieceLength;
+    }
+    memcpy(source + length, "true", 5);
+    return source;
+}
+
+static char* readScript(const char* name) {
+    const char* directory = getenv("SIEW_BENCH_SCRIPTS");
+    if (directory == NULL) directory = SIEW_BENCH_SCRIPTS;
+
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", directory, name);
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Could not open \"%s\" (set SIEW_BENCH_SCRIPTS to the scripts directory).\n", path);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    rewind(file);
+    char* source = size >= 0 ? malloc((size_t)size + 1) : NULL;
+    if (source == NULL || fread(source, 1, (size_t)size, file) != (size_t)size) {
+        fprintf(stderr, "Could not read \"%s\".\n", path);
+        free(source);
+        fclose(file);
+        return NULL;
+    }
+    source[size] = '\0';
+    fclose(file);
+    return source;
+}
+
+static bool runOnce(const SuiteCase* suiteCase, const char* source, size_t length, OutputSink* sink) {
+    if (suiteCase->mode == CASE_RUN) {
+        InterpretResult result = interpret(source);
+        resetCapturedOutput(sink);
+        return result == INTERPRET_OK;
+    }
+
+    // the same arena interpret() compiles into
+    Chunk chunk;
+    initChunkInArena(&chunk, &vm.compileArena, length > INT_MAX ? INT_MAX : (int)length);
+    bool compiled = compile(source, &chunk);
+    freeChunk(&chunk);
+    resetArena(&vm.compileArena);
+    return compiled;
+}
+
+static double sample(const SuiteCase* suiteCase, const char* source, size_t length, int iterations,
+                     OutputSink* sink, bool* ok) {
+    double start = benchNow();
+    for (int i = 0; i < iterations; i++) {
+        if (!runOnce(suiteCase, source, length, sink)) *ok = false;
+    }
+    return (benchNow() - start) / iterations;
+}
+
+static int compareDoubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void measure(const SuiteCase* suiteCase, const char* source, OutputSink* sink, CaseResult* result) {
+    size_t length = strlen(source);
+    result->ok = true;
+
+    // one run tells us how many make a sample long enough to time
+    double once = sample(suiteCase, source, length, 1, sink, &result->ok);
+    result->iterations = once >= SAMPLE_SECONDS ? 1 : (int)ceil(SAMPLE_SECONDS / (once > 1e-9 ? once : 1e-9));
+
+    for (int i = 0; i < benchOptions.warmup; i++) {
+        sample(suiteCase, source, length, result->iterations, sink, &result->ok);
+    }
+
+    int n = benchOptions.repetitions;
+    result->samples = malloc(sizeof(double) * (size_t)n);
+    double sum = 0;
+    for (int i = 0; i < n; i++) {
+        result->samples[i] = sample(suiteCase, source, length, result->iterations, sink, &result->ok);
+        sum += result->samples[i];
+    }
+
+    result->mean = sum / n;
+    double squares = 0;
+    for (int i = 0; i < n; i++) squares += (result->samples[i] - result->mean) * (result->samples[i] - result->mean);
+    result->stddev = sqrt(squares / (n - 1));
+
+    // the samples stay in the order they were taken for the JSON, we sort a copy
+    double* sorted = malloc(sizeof(double) * (size_t)n);
+    memcpy(sorted, result->samples, sizeof(double) * (size_t)n);
+    qsort(sorted, (size_t)n, sizeof(double), compareDoubles);
+    result->median = n % 2 == 1 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+    result->min = sorted[0];
+    result->max = sorted[n - 1];
+    free(sorted);
+}
+
+// The regularized incomplete beta function I_x(a, b), by its continued fraction (modified Lentz).
+// All we need it for is the t distribution, so a and b are never far from what the t-test gives it.
+static double incompleteBeta(double x, double a, double b) {
+    if (x <= 0) return 0;
+    if (x >= 1) return 1;
+    // the continued fraction converges fast only on this side, the other one comes from the symmetry
+    if (x > (a + 1) / (a + b + 2)) return 1 - incompleteBeta(1 - x, b, a);
+
+    double front = exp(lgamma(a + b) - lgamma(a) - lgamma(b) + a * log(x) + b * log(1 - x)) / a;
+    double tiny = 1e-300;
+    double c = 1;
+    double d = 1 - (a + b) * x / (a + 1);
+    if (fabs(d) < tiny) d = tiny;
+    d = 1 / d;
+    double fraction = d;
+
+    for (int m = 1; m <= 200; m++) {
+        // the even step, then the odd one
+        double numerator = m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m));
+        d = 1 + numerator * d;
+        if (fabs(d) < tiny) d = tiny;
+        c = 1 + numerator / c;
+        if (fabs(c) < tiny) c = tiny;
+        d = 1 / d;
+        fraction *= d * c;
+
+        numerator = -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1));
+        d = 1 + numerator * d;
+        if (fabs(d) < tiny) d = tiny;
+        c = 1 + numerator / c;
+        if (fabs(c) < tiny) c = tiny;
+        d = 1 / d;
+        double delta = d * c;
+        fraction *= delta;
+        if (fabs(delta - 1) < 1e-12) break;
+    }
+    return front * fraction;
+}
+
+// Welch's t-test: are the two means different, without assuming both runs are equally noisy?
+static double welchP(double mean1, double stddev1, int n1, double mean2, double stddev2, int n2) {
+    double variance1 = stddev1 * stddev1 / n1;
+    double variance2 = stddev2 * stddev2 / n2;
+    if (variance1 + variance2 == 0) return mean1 == mean2 ? 1 : 0;
+
+    double t = (mean1 - mean2) / sqrt(variance1 + variance2);
+    double df = (variance1 + variance2) * (variance1 + variance2)
+        / (variance1 * variance1 / (n1 - 1) + variance2 * variance2 / (n2 - 1));
+    return incompleteBeta(df / (df + t * t), df / 2, 0.5);
+}
+
+// The value of "key" in the JSON between start and end. Only for files we wrote ourselves (see writeJson).
+static bool findNumber(const char* start, const char* end, const char* key, double* value) {
+    char quoted[64];
+    snprintf(quoted, sizeof(quoted), "\"%s\":", key);
+    const char* found = strstr(start, quoted);
+    if (found == NULL || found >= end) return false;
+    *value = strtod(found + strlen(quoted), NULL);
+    return true;
+}
+
+static void compare(const char* baseline, const char* name, const CaseResult* result, Comparison* comparison) {
+    comparison->found = false;
+    if (baseline == NULL) return;
+
+    char quoted[128];
+    snprintf(quoted, sizeof(quoted), "\"name\": \"%s\"", name);
+    const char* start = strstr(baseline, quoted);
+    if (start == NULL) return;
+    const char* end = strchr(start, '}'); // a case is a flat object
+    if (end == NULL) end = start + strlen(start);
+
+    double repetitions;
+    if (!findNumber(start, end, "mean", &comparison->mean) || !findNumber(start, end, "stddev", &comparison->stddev)
+        || !findNumber(start, end, "repetitions", &repetitions) || repetitions < 2) {
+        return;
+    }
+    comparison->found = true;
+    comparison->repetitions = (int)repetitions;
+    comparison->change = result->mean / comparison->mean - 1;
+    comparison->p = welchP(result->mean, result->stddev, benchOptions.repetitions,
+                           comparison->mean, comparison->stddev, comparison->repetitions);
+
+    // it has to be real (p) and big enough to care about (change)
+    if (comparison->p >= MAX_P || fabs(comparison->change) < MIN_CHANGE) {
+        comparison->verdict = "same";
+    } else {
+        comparison->verdict = comparison->change > 0 ? "slower" : "faster";
+    }
+}
+
+static char* readBaseline(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Could not open baseline \"%s\".\n", path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    rewind(file);
+    char* text = size >= 0 ? malloc((size_t)size + 1) : NULL;
+    if (text != NULL) text[fread(text, 1, (size_t)size, file)] = '\0';
+    fclose(file);
+    return text;
+}
+
+static void writeJson(const char* path, const CaseResult* results, const Comparison* comparisons) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "Could not write \"%s\".\n", path);
+        return;
+    }
+
+    fprintf(file, "{\n  \"format\": \"siew_bench\",\n  \"version\": 1,\n");
+#ifdef DEBUG_TRACE_EXECUTION
+    fprintf(file, "  \"trace\": true,\n");
+#else
+    fprintf(file, "  \"trace\": false,\n");
+#endif
+    fprintf(file, "  \"unit\": \"seconds\",\n  \"warmup\": %d,\n  \"cases\": [\n", benchOptions.warmup);
+
+    // one case per object, and no nested objects in it: compare() relies on that to read it back
+    for (int i = 0; i < SUITE_COUNT; i++) {
+        const CaseResult* result = &results[i];
+        fprintf(file, "    {\"name\": \"%s\", \"ok\": %s, \"iterations\": %d, \"repetitions\": %d, "
+            "\"mean\": %.9g, \"stddev\": %.9g, \"median\": %.9g, \"min\": %.9g, \"max\": %.9g",
+            suite[i].name, result->ok ? "true" : "false", result->iterations, benchOptions.repetitions,
+            result->mean, result->stddev, result->median, result->min, result->max);
+
+        if (comparisons[i].found) {
+            fprintf(file, ", \"baseline_mean\": %.9g, \"change\": %.6f, \"p\": %.6g, \"verdict\": \"%s\"",
+                comparisons[i].mean, comparisons[i].change, comparisons[i].p, comparisons[i].verdict);
+        }
+
+        fprintf(file, ", \"samples\": [");
+        for (int s = 0; s < benchOptions.repetitions; s++) {
+            fprintf(file, "%s%.9g", s == 0 ? "" : ", ", result->samples[s]);
+        }
+        fprintf(file, "]}%s\n", i + 1 < SUITE_COUNT ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+}
+
+void benchSuite() {
+#ifdef DEBUG_TRACE_EXECUTION
+    printf("warning: built with the execution trace on, these numbers measure the trace\n");
+#endif
+    initVM();
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+
+    char* baseline = benchOptions.baselinePath != NULL ? readBaseline(benchOptions.baselinePath) : NULL;
+    CaseResult results[SUITE_COUNT];
+    Comparison comparisons[SUITE_COUNT];
+
+    printf("%d warmup + %d measured samples per case\n", benchOptions.warmup, benchOptions.repetitions);
+    printf("%-14s %10s %12s %10s %8s", "case", "runs", "mean (us)", "stddev", "min");
+    if (baseline != NULL) printf(" %10s %8s %8s", "baseline", "change", "p");
+    printf("\n");
+
+    for (int i = 0; i < SUITE_COUNT; i++) {
+        char* source = suite[i].script != NULL ? readScript(suite[i].script) : suite[i].generate();
+        CaseResult* result = &results[i];
+        if (source == NULL) {
+            // still in the report, as failed, so the case doesn't silently vanish from the comparison
+            memset(result, 0, sizeof(CaseResult));
+            result->samples = calloc((size_t)benchOptions.repetitions, sizeof(double));
+        } else {
+            measure(&suite[i], source, sink, result);
+            free(source);
+        }
+
+        compare(baseline, suite[i].name, result, &comparisons[i]);
+        if (comparisons[i].found && strcmp(comparisons[i].verdict, "slower") == 0) benchRegressed = true;
+
+        printf("%-14s %10d %12.3f %9.1f%% %8.3f", suite[i].name, result->iterations * benchOptions.repetitions,
+            result->mean * 1e6, result->mean > 0 ? result->stddev / result->mean * 100 : 0, result->min * 1e6);
+        if (comparisons[i].found) {
+            printf(" %10.3f %+7.1f%% %8.3g  %s", comparisons[i].mean * 1e6, comparisons[i].change * 100,
+                comparisons[i].p, comparisons[i].verdict);
+        }
+        printf("%s\n", result->ok ? "" : "  FAILED");
+        // a script that doesn't run is worse than a slow one
+        if (!result->ok) benchRegressed = true;
+        fflush(stdout);
+    }
+
+    if (benchOptions.jsonPath != NULL) writeJson(benchOptions.jsonPath, results, comparisons);
+
+    for (int i = 0; i < SUITE_COUNT; i++) free(results[i].samples);
+    free(baseline);
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
@@ -0,0 +1,248 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+// for getrusage
+#define _XOPEN_SOURCE 700
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/scanner.h"
+#include "siew/vm.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#define SIEW_HAS_RUSAGE
+#endif
+
+#define MIN_SOURCE_SIZE 1024
+#define SIZE_STEP 4 // each size is this many times the previous one
+#define REFERENCE_SIZE (64 * 1024) // the first sizes are all fixed costs (VM and scanner setup), here they stop mattering
+#define IN_MEMORY_MAX (64 * 1024 * 1024) // bigger sources go to a temporary file and are streamed, like `siew big.sw`
+#define MIN_MEASURE 0.05 // seconds, small sources are scanned/compiled again and again until they add up to this
+#define MAX_SCALING 3.0 // compile time per byte can grow this much from REFERENCE_SIZE to the biggest source
+#define PIECE_MAX 128
+#define WRITE_BUFFER (1024 * 1024)
+
+// Generates the kind of expression our exporters write: one huge flat expression over many lines, with numbers
+// of every encoding (small ints, doubles), booleans, nil, unary operators, groups and comments.
+// No strings: each one takes a slot in the constant pool, and OP_CONSTANT can only address 256 of them.
+typedef struct {
+    uint64_t state;
+    int column;
+} SourceGenerator;
+
+static uint32_t nextRandom(SourceGenerator* generator) {
+    // xorshift64, the same sequence on every machine
+    generator->state ^= generator->state << 13;
+    generator->state ^= generator->state >> 7;
+    generator->state ^= generator->state << 17;
+    return (uint32_t)(generator->state >> 32);
+}
+
+static int writeOperand(SourceGenerator* generator, char* out) {
+    uint32_t pick = nextRandom(generator);
+    uint32_t value = nextRandom(generator);
+    switch (pick % 10) {
+        case 0: return sprintf(out, "true");
+        case 1: return sprintf(out, "nil");
+        case 2: return sprintf(out, "!false");
+        case 3: return sprintf(out, "-%u", value % 100);
+        case 4: return sprintf(out, "%u.%02u", value % 10000, value % 100);
+        case 5: return sprintf(out, "(%u * %u - %u)", value % 50, value % 7 + 1, value % 127);
+        case 6: return sprintf(out, "%u", value % 100000);
+        default: return sprintf(out, "%u", value % 128);
+    }
+}
+
+// One operand and the operator after it, at most PIECE_MAX bytes
+static int nextPiece(SourceGenerator* generator, char* out) {
+    static const char* operators[] = {" + ", " - ", " * ", " / ", " == ", " != ", " < ", " >= "};
+    int length = writeOperand(generator, out);
+    length += sprintf(out + length, "%s", operators[nextRandom(generator) % 8]);
+
+    generator->column += length;
+    if (generator->column > 80) {
+        uint32_t pick = nextRandom(generator) % 16;
+        length += sprintf(out + length, pick == 0 ? "\n    // generated by the exporter, do not edit\n    " : "\n    ");
+        generator->column = 4;
+    }
+    return length;
+}
+
+// the last operand, so the source ends in a complete expression
+#define SOURCE_END "1\n"
+
+static char* generateSource(size_t size, size_t* length) {
+    SourceGenerator generator = {0x9E3779B97F4A7C15ull, 0};
+    char* source = malloc(size + PIECE_MAX + sizeof(SOURCE_END));
+    if (source == NULL) return NULL;
+
+    size_t used = 0;
+    while (used < size) used += (size_t)nextPiece(&generator, source + used);
+    memcpy(source + used, SOURCE_END, sizeof(SOURCE_END));
+    *length = used + sizeof(SOURCE_END) - 1;
+    return source;
+}
+
+static FILE* generateSourceFile(size_t size, size_t* length) {
+    SourceGenerator generator = {0x9E3779B97F4A7C15ull, 0};
+    FILE* file = tmpfile();
+    char* buffer = malloc(WRITE_BUFFER + PIECE_MAX);
+    if (file == NULL || buffer == NULL) {
+        if (file != NULL) fclose(file);
+        free(buffer);
+        return NULL;
+    }
+
+    size_t written = 0;
+    while (written < size) {
+        size_t used = 0;
+        while (used < WRITE_BUFFER && written + used < size) {
+            used += (size_t)nextPiece(&generator, buffer + used);
+        }
+        fwrite(buffer, 1, used, file);
+        written += used;
+    }
+    fputs(SOURCE_END, file);
+    *length = written + sizeof(SOURCE_END) - 1;
+    free(buffer);
+    return file;
+}
+
+static size_t maxResidentBytes() {
+#ifdef SIEW_HAS_RUSAGE
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return (size_t)usage.ru_maxrss;
+#else
+    return (size_t)usage.ru_maxrss * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+// Scans the whole source through the same batches the compiler asks for. Returns the tokens, EOF included.
+static uint64_t scanOnce(const char* source, FILE* file) {
+    static TokenBuffer buffer;
+    if (file != NULL) {
+        rewind(file);
+        initScannerFile(file);
+    } else {
+        initScanner(source);
+    }
+
+    uint64_t tokens = 0;
+    for (;;) {
+        scanTokens(&buffer, NULL);
+        tokens += (uint64_t)buffer.count;
+        if (buffer.count == 0 || buffer.types[buffer.count - 1] == TOKEN_EOF) break;
+    }
+    if (file != NULL) freeScannerFile();
+    return tokens;
+}
+
+// Compiles into the compile arena like interpret() does. Returns the bytecode size, -1 if it didn't compile.
+static int compileOnce(const char* source, FILE* file, size_t length) {
+    Chunk chunk;
+    initChunkInArena(&chunk, &vm.compileArena, file != NULL || length > INT_MAX ? 0 : (int)length);
+    bool compiled;
+    if (file != NULL) {
+        rewind(file);
+        compiled = compileFile(file, &chunk);
+    } else {
+        compiled = compile(source, &chunk);
+    }
+    int count = compiled ? chunk.count : -1;
+    freeChunk(&chunk);
+    resetArena(&vm.compileArena);
+    return count;
+}
+
+static double measureSize(size_t size) {
+    size_t length = 0;
+    char* source = NULL;
+    FILE* file = NULL;
+    if (size <= IN_MEMORY_MAX) {
+        source = generateSource(size, &length);
+    } else {
+        file = generateSourceFile(size, &length);
+    }
+    if (source == NULL && file == NULL) {
+        printf("%-10zu could not generate the source\n", size);
+        return 0;
+    }
+
+    uint64_t tokens = 0;
+    int scans = 0;
+    double start = benchNow();
+    double scanSeconds;
+    do {
+        tokens = scanOnce(source, file);
+        scans++;
+        scanSeconds = benchNow() - start;
+    } while (scanSeconds < MIN_MEASURE);
+    scanSeconds /= scans;
+
+    // a fresh VM per size, so the peak is this source's alone (the intern table, the arena's kept block...)
+    initVM();
+    resetStats();
+    size_t baseline = vm.bytesAllocated;
+    int code = 0;
+    int compiles = 0;
+    start = benchNow();
+    double compileSeconds;
+    do {
+        code = compileOnce(source, file, length);
+        compiles++;
+        compileSeconds = benchNow() - start;
+    } while (compileSeconds < MIN_MEASURE && code >= 0);
+    compileSeconds /= compiles;
+    size_t peak = (size_t)vm.stats.peakBytes - baseline;
+    freeVM();
+
+    if (code < 0) {
+        printf("%-10zu did not compile\n", size);
+    } else {
+        double megabytes = (double)length / (1024 * 1024);
+        printf("%-10zu %-6s %12llu %9.1f %9.1f %9.1f %9.1f %8.2f %12zu %12zu\n", length, file != NULL ? "stream" : "memory",
+            (unsigned long long)tokens, megabytes / scanSeconds, tokens / scanSeconds / 1e6, megabytes / compileSeconds,
+            code / compileSeconds / (1024 * 1024), compileSeconds * 1e9 / (double)length, peak, maxResidentBytes());
+    }
+
+    free(source);
+    if (file != NULL) fclose(file);
+    return code < 0 ? 0 : compileSeconds * 1e9 / (double)length;
+}
+
+// Scanning and compiling on their own (nothing runs), from 1 KB of source up to benchOptions.maxSourceSize.
+// Both should be linear: if the time per byte of the biggest source drifts away from the small ones,
+// something in the compiler went quadratic (or the chunk started to reallocate too much).
+void benchThroughput() {
+    printf("%-10s %-6s %12s %9s %9s %9s %9s %8s %12s %12s\n", "bytes", "source", "tokens", "scan MB/s", "Mtok/s",
+        "comp MB/s", "code MB/s", "ns/byte", "peak heap", "max rss");
+
+    double reference = 0;
+    double largest = 0;
+    for (size_t size = MIN_SOURCE_SIZE; size <= benchOptions.maxSourceSize; size *= SIZE_STEP) {
+        double nsPerByte = measureSize(size);
+        if (size == REFERENCE_SIZE) reference = nsPerByte;
+        if (nsPerByte > 0) largest = nsPerByte;
+        fflush(stdout);
+    }
+
+    if (reference > 0 && largest > 0) {
+        double scaling = largest / reference;
+        printf("compile time per byte, biggest source vs 64 KB: %.2fx%s\n", scaling,
+            scaling > MAX_SCALING ? " (superlinear!)" : "");
+        if (scaling > MAX_SCALING) benchRegressed = true;
+    }
+}
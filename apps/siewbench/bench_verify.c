@@ -0,0 +1,198 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+// for dup/dup2
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/output.h"
+#include "siew/verifier.h"
+#include "siew/vm.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define SIEW_HAS_DUP
+#endif
+
+#define MUTANT_COUNT 200000
+#define MAX_CODE 512
+#define VERIFY_ROUNDS 200
+
+// The fuzz corpus: real compiled programs, that every mutant starts from
+static const char* seeds[] = {
+    "1",
+    "nil",
+    "-(1 + 2) * 3 - -4 / 5",
+    "!(5 - 4 > 3 * 2 == !nil)",
+    "\"st\" + \"ri\" + \"ng\" == \"string\"",
+    "(1 + (2 + (3 + (4 + (5 + (6 + (7 + 8)))))))",
+    "\"a\" + \"b\" == \"ab\" == !(1 < 2) == (3 >= 4) == (5 != 6)",
+    "true == false == nil == !true == !!false",
+    "1.5 * 2 / (3 - 0.25) + 100000 - 0.001",
+};
+
+#define SEED_COUNT (int)(sizeof(seeds) / sizeof(seeds[0]))
+
+static uint64_t state = 0x2545F4914F6CDD1Dull;
+
+static uint32_t nextRandom() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return (uint32_t)(state >> 32);
+}
+
+// one to four of the usual mutations: change a byte, drop some, duplicate some, cut the end, lie about the stack
+static int mutate(uint8_t* code, int count, int* maxStack) {
+    int mutations = 1 + (int)(nextRandom() % 4);
+    for (int m = 0; m < mutations && count > 0; m++) {
+        int at = (int)(nextRandom() % (uint32_t)count);
+        switch (nextRandom() % 6) {
+            case 0: code[at] = (uint8_t)nextRandom(); break;
+            case 1: code[at] = (uint8_t)(nextRandom() % OP_COUNT); break;
+            case 2: {
+                int length = 1 + (int)(nextRandom() % 4);
+                if (at + length > count) length = count - at;
+                memmove(code + at, code + at + length, (size_t)(count - at - length));
+                count -= length;
+                break;
+            }
+            case 3: {
+                int length = 1 + (int)(nextRandom() % 8);
+                if (at + length > count) length = count - at;
+                if (count + length > MAX_CODE) break;
+                memmove(code + at + length, code + at, (size_t)(count - at));
+                count += length;
+                break;
+            }
+            case 4: count = at; break;
+            // now and then a huge one, that the VM must not try to reserve
+            case 5: *maxStack = nextRandom() % 8 == 0 ? INT_MAX : (int)(nextRandom() % 8) - 1; break;
+        }
+    }
+    return count;
+}
+
+// Everything the verifier accepts has to run without touching memory it shouldn't (build with ASan to see it)
+static void fuzzVerifier(Chunk* compiled, OutputSink* sink) {
+    static uint8_t code[MAX_CODE];
+    static int lines[MAX_CODE];
+    for (int i = 0; i < MAX_CODE; i++) lines[i] = 1;
+
+    int accepted = 0;
+    int reasons[8] = {0};
+    static const char* messages[8];
+    int reasonCount = 0;
+
+    double start = benchNow();
+    for (int i = 0; i < MUTANT_COUNT; i++) {
+        Chunk* seed = &compiled[i % SEED_COUNT];
+        memcpy(code, seed->code, (size_t)seed->count);
+        int maxStack = seed->maxStack;
+        int count = mutate(code, seed->count, &maxStack);
+
+        // the seed's constants, the mutant's code
+        Chunk mutant = *seed;
+        mutant.code = code;
+        mutant.lines = lines;
+        mutant.count = count;
+        mutant.capacity = MAX_CODE;
+        mutant.maxStack = maxStack;
+        mutant.verified = false;
+
+        VerifyError error;
+        if (verifyChunk(&mutant, &error)) {
+            accepted++;
+            interpretChunk(&mutant);
+            resetCapturedOutput(sink);
+            continue;
+        }
+
+        int reason = 0;
+        while (reason < reasonCount && messages[reason] != error.message) reason++;
+        if (reason == reasonCount && reasonCount < 8) messages[reasonCount++] = error.message;
+        if (reason < 8) reasons[reason]++;
+    }
+    double end = benchNow();
+
+    printf("fuzz   %d mutants of %d seeds in %.1f ms: %d accepted and ran\n",
+        MUTANT_COUNT, SEED_COUNT, (end - start) * 1e3, accepted);
+    for (int i = 0; i < reasonCount; i++) printf("       %7d rejected: %s\n", reasons[i], messages[i]);
+}
+
+// how much the check costs, on a long chunk
+static void verifySpeed() {
+    static const char* piece = "!(true == false) == (nil == nil) == !!(false == !true) == ";
+    size_t pieceLength = strlen(piece);
+    size_t length = 0;
+    char* source = malloc(pieceLength * 4000 + 8);
+    for (int i = 0; i < 4000; i++) {
+        memcpy(source + length, piece, pieceLength);
+        length += pieceLength;
+    }
+    memcpy(source + length, "true", 5);
+
+    Chunk chunk;
+    initChunk(&chunk);
+    compile(source, &chunk);
+
+    double start = benchNow();
+    for (int round = 0; round < VERIFY_ROUNDS; round++) {
+        chunk.verified = false;
+        verifyChunk(&chunk, NULL);
+    }
+    double end = benchNow();
+
+    printf("verify %d bytes of code: %.3f ms each, %.1f MB/s\n",
+        chunk.count, (end - start) / VERIFY_ROUNDS * 1e3, (double)chunk.count * VERIFY_ROUNDS / (end - start) / (1024 * 1024));
+
+    freeChunk(&chunk);
+    free(source);
+}
+
+void benchVerify() {
+    initVM();
+    OutputSink* sink = malloc(sizeof(OutputSink));
+    initCaptureSink(sink);
+    setOutputSink(sink);
+
+    Chunk compiled[SEED_COUNT];
+    for (int i = 0; i < SEED_COUNT; i++) {
+        initChunk(&compiled[i]);
+        compile(seeds[i], &compiled[i]);
+    }
+
+    // runtime errors from the mutants that pass (adding a bool to a number...) are expected, and noisy
+#ifdef SIEW_HAS_DUP
+    fflush(stderr);
+    int savedErrors = dup(STDERR_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    if (devNull >= 0) dup2(devNull, STDERR_FILENO);
+#endif
+    fuzzVerifier(compiled, sink);
+#ifdef SIEW_HAS_DUP
+    fflush(stderr);
+    if (devNull >= 0) {
+        dup2(savedErrors, STDERR_FILENO);
+        close(devNull);
+    }
+    close(savedErrors);
+#endif
+
+    verifySpeed();
+
+    for (int i = 0; i < SEED_COUNT; i++) freeChunk(&compiled[i]);
+    setOutputSink(NULL);
+    freeOutputSink(sink);
+    free(sink);
+    freeVM();
+}
@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "siew/common.h"
+
+typedef void (*BenchFn)();
+
+typedef struct {
+    const char* name;
+    BenchFn run;
+} Benchmark;
+
+static Benchmark benchmarks[] = {
+    {"strings", benchStrings},
+    {"intern", benchIntern},
+    {"slice", benchSlice},
+    {"compile", benchCompile},
+    {"memory", benchMemory},
+    {"scanner", benchScanner},
+    {"stream", benchStream},
+    {"number", benchNumber},
+    {"output", benchOutput},
+    {"dispatch", benchDispatch},
+    {"verify", benchVerify},
+    {"opcodes", benchOpcodes},
+    {"literals", benchLiterals},
+    {"suite", benchSuite},
+    {"throughput", benchThroughput},
+    {"backends", benchBackends},
+    {"integers", benchIntegers},
+    {"arrays", benchArrays},
+};
+
+#define BENCHMARK_COUNT (int)(sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+// 64 MB keeps a run of everything short, --max-source 1G is the whole scale
+BenchOptions benchOptions = {3, 20, NULL, NULL, 64 * 1024 * 1024};
+bool benchRegressed = false;
+
+static void usage() {
+    fprintf(stderr, "Usage: siew_bench [--warmup n] [--repetitions n] [--json path] [--baseline path] [--max-source size[K|M|G]] [benchmark...]\n");
+    exit(64);
+}
+
+// "64M" is 64 * 1024 * 1024, 0 if it is not a size
+static size_t parseSize(const char* text) {
+    char* end;
+    unsigned long long size = strtoull(text, &end, 10);
+    switch (*end) {
+        case 'G': size *= 1024;
+        // fall through
+        case 'M': size *= 1024;
+        // fall through
+        case 'K': size *= 1024; end++; break;
+        default: break;
+    }
+    return *end == '\0' ? (size_t)size : 0;
+}
+
+// the value after an option, or the usage if there is none
+static const char* optionValue(int argc, char* argv[], int* arg) {
+    if (*arg + 1 >= argc) usage();
+    return argv[++*arg];
+}
+
+int main(int argc, char *argv[]) {
+    // options first, then the names of the benchmarks to run
+    int first = 1;
+    while (first < argc && strncmp(argv[first], "--", 2) == 0) {
+        if (strcmp(argv[first], "--warmup") == 0) {
+            benchOptions.warmup = atoi(optionValue(argc, argv, &first));
+            if (benchOptions.warmup < 0) usage();
+        } else if (strcmp(argv[first], "--repetitions") == 0) {
+            benchOptions.repetitions = atoi(optionValue(argc, argv, &first));
+            if (benchOptions.repetitions < 2) usage(); // one sample has no spread, nothing to compare
+        } else if (strcmp(argv[first], "--json") == 0) {
+            benchOptions.jsonPath = optionValue(argc, argv, &first);
+        } else if (strcmp(argv[first], "--baseline") == 0) {
+            benchOptions.baselinePath = optionValue(argc, argv, &first);
+        } else if (strcmp(argv[first], "--max-source") == 0) {
+            benchOptions.maxSourceSize = parseSize(optionValue(argc, argv, &first));
+            if (benchOptions.maxSourceSize == 0) usage();
+        } else {
+            usage();
+        }
+        first++;
+    }
+
+    // no names: run everything. Otherwise run only the benchmarks named.
+    bool ranAny = false;
+    for (int i = 0; i < BENCHMARK_COUNT; i++) {
+        bool selected = first == argc;
+        for (int arg = first; arg < argc; arg++) {
+            if (strcmp(argv[arg], benchmarks[i].name) == 0) selected = true;
+        }
+
+        if (!selected) continue;
+        printf("== %s ==\n", benchmarks[i].name);
+        fflush(stdout);
+        benchmarks[i].run();
+        ranAny = true;
+    }
+
+    if (!ranAny) usage();
+
+    // so a script (or CI) can tell, without reading the report
+    return benchRegressed ? 1 : 0;
+}
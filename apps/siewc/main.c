@@ -1,54 +1,78 @@
+// for mmap, fileno and sysconf
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "siew/allocprofile.h"
 #include "siew/common.h"
 #include "siew/chunk.h"
 #include "siew/debug.h"
+#include "siew/sampler.h"
+#include "siew/stats.h"
 #include "siew/vm.h"
 
-static char* readFile(const char* path) {
-    FILE* file = fopen(path, "rb"); // we open the file, the pointer is at the beginning
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SIEW_HAS_MMAP
+#endif
+
+#ifdef SIEW_HAS_MMAP
+// Instead of copying the file into a buffer, we ask the OS to map it into memory: pages are read when the
+// scanner touches them, and they don't count as ours once it is done with them.
+// The scanner needs a '\0' after the last char. The OS fills the rest of the last page with zeros, so we
+// get it for free, unless the file ends exactly at a page boundary. Then (and for empty files, or things
+// that can't be mapped) we return false and the caller streams the file instead.
+static bool runMapped(FILE* file, InterpretResult* result) {
+    struct stat info;
+    if (fstat(fileno(file), &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0) return false;
+
+    size_t size = (size_t)info.st_size;
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize <= 0 || size % (size_t)pageSize == 0) return false;
+
+    void* mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+    if (mapped == MAP_FAILED) return false;
+
+    // the scanner goes from start to end once
+    posix_madvise(mapped, size, POSIX_MADV_SEQUENTIAL);
+    *result = interpret((const char*)mapped);
+    munmap(mapped, size);
+    return true;
+}
+#endif
 
-    fseek(file, 0L, SEEK_END); // we move the pointer to the end
+// path "-" means the script comes from stdin. Returns the exit status.
+static int runFile(const char* path) {
+    bool fromStdin = strcmp(path, "-") == 0;
+    FILE* file = fromStdin ? stdin : fopen(path, "rb");
 
     if (file == NULL) {
         fprintf(stderr, "Could not open file \"%s\".\n", path);
         exit(74);
     }
 
-    size_t fileSize = ftell(file); // then we ask how many bytes exist from the end to the beginning
-    rewind(file); // we move the pointer again to the beginning
-
-    // + 1 to for the null byte at the end
-    char* buffer = (char*)malloc(fileSize + 1); // we save the bytes in a buffer (and we tell that those are chars)
-
-    if (buffer == NULL) {
-        fprintf(stderr, "Not enough memory to read \"%s\".\n", path);
-        exit(74);
-    }
-
-    // and we read the file in one go and store it in the buffer
-    size_t bytesRead = fread(buffer, sizeof(char), fileSize, file);
+    InterpretResult result;
+    bool ran = false;
+#ifdef SIEW_HAS_MMAP
+    ran = runMapped(file, &result);
+#endif
+    // a pipe, or a file we could not map: the compiler reads it a window at a time,
+    // so we never need the whole thing in memory (nor to know how big it is)
+    if (!ran) result = interpretFile(file);
 
-    if (bytesRead < fileSize) {
+    if (ferror(file)) {
         fprintf(stderr, "Could not read file \"%s\".\n", path);
         exit(74);
     }
+    if (!fromStdin) fclose(file);
 
-    // we add the null byte at the end
-    buffer[bytesRead] = '\0';
-
-    fclose(file);
-    return buffer;
-}
-
-static void runFile(const char* path) {
-    char* source = readFile(path);
-    InterpretResult result = interpret(source);
-    free(source);
-
-    if (result == INTERPRET_COMPILE_ERROR) exit(65);
-    if (result == INTERPRET_RUNTIME_ERROR) exit(70);
+    if (result == INTERPRET_COMPILE_ERROR) return 65;
+    if (result == INTERPRET_RUNTIME_ERROR) return 70;
+    return 0;
 }
 
 // TODO: THIS CAN BE BETTER, HANDLE MULTIPLE LINES, WITH NOT HARDCODED LINE LENGTH LIMIT
@@ -67,18 +91,104 @@ static void repl() {
     }
 }
 
+static void usage() {
+    fprintf(stderr, "Usage: siew [--profile path] [--profile-hz n] [--alloc-profile path] [--stats path] [--backend stack|register] [path | -]\n");
+    exit(64);
+}
+
 int main(int argc, char *argv[]) {
+    // --profile samples the whole run and writes it as folded stacks, for flamegraph.pl (see sampler.h)
+    const char* profilePath = NULL;
+    int profileHz = SAMPLER_DEFAULT_HZ;
+    // --alloc-profile charges every allocation to its site, opcode and line (see allocprofile.h)
+    const char* allocProfilePath = NULL;
+    // --stats writes the VM counters as JSON at the end (see stats.h)
+    const char* statsPath = NULL;
+    // --backend register compiles to the three-address instructions instead (see FOR_EACH_REGISTER_OPCODE)
+    Backend backend = BACKEND_STACK;
+    int arg = 1;
+    while (arg < argc && strncmp(argv[arg], "--", 2) == 0) {
+        if (strcmp(argv[arg], "--profile") == 0 && arg + 1 < argc) {
+            profilePath = argv[++arg];
+        } else if (strcmp(argv[arg], "--profile-hz") == 0 && arg + 1 < argc) {
+            profileHz = atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--alloc-profile") == 0 && arg + 1 < argc) {
+            allocProfilePath = argv[++arg];
+        } else if (strcmp(argv[arg], "--stats") == 0 && arg + 1 < argc) {
+            statsPath = argv[++arg];
+        } else if (strcmp(argv[arg], "--backend") == 0 && arg + 1 < argc) {
+            arg++;
+            if (strcmp(argv[arg], "stack") == 0) backend = BACKEND_STACK;
+            else if (strcmp(argv[arg], "register") == 0) backend = BACKEND_REGISTER;
+            else usage();
+        } else {
+            usage();
+        }
+        arg++;
+    }
+    if (argc - arg > 1 || profileHz <= 0) usage();
+
     initVM();
+    setBackend(backend);
+
+    // opened before running, a path we can't write fails now and not after a long run
+    FILE* profile = NULL;
+    if (profilePath != NULL) {
+        profile = fopen(profilePath, "w");
+        if (profile == NULL) {
+            fprintf(stderr, "Could not open file \"%s\".\n", profilePath);
+            exit(74);
+        }
+        if (!startSampling(profileHz)) {
+            fprintf(stderr, "Sampling is not supported on this platform.\n");
+            exit(69);
+        }
+    }
+    FILE* allocProfile = NULL;
+    if (allocProfilePath != NULL) {
+        allocProfile = fopen(allocProfilePath, "w");
+        if (allocProfile == NULL) {
+            fprintf(stderr, "Could not open file \"%s\".\n", allocProfilePath);
+            exit(74);
+        }
+        startAllocationProfile();
+    }
+    FILE* stats = NULL;
+    if (statsPath != NULL) {
+        stats = fopen(statsPath, "w");
+        if (stats == NULL) {
+            fprintf(stderr, "Could not open file \"%s\".\n", statsPath);
+            exit(74);
+        }
+    }
 
-    if (argc == 1) {
+    int status = 0;
+    if (arg == argc) {
         repl();
-    } else if (argc == 2) {
-        runFile(argv[1]);
     } else {
-        fprintf(stderr, "Usage: siew [path]\n");
-        exit(64);
+        // a script that fails still shuts the VM down (flushing its output, writing the opcode profile...)
+        status = runFile(argv[arg]);
+    }
+
+    if (profile != NULL) {
+        stopSampling();
+        const char* name = arg == argc ? "repl" : strcmp(argv[arg], "-") == 0 ? "stdin" : argv[arg];
+        writeFoldedSamples(profile, name);
+        fclose(profile);
+    }
+    // before freeVM(), the live heap is part of the report
+    if (allocProfile != NULL) {
+        stopAllocationProfile();
+        writeAllocationProfile(allocProfile);
+        fclose(allocProfile);
+    }
+    if (stats != NULL) {
+        StatsSnapshot snapshot;
+        snapshotStats(&snapshot);
+        writeStatsJson(stats, &snapshot);
+        fclose(stats);
     }
 
     freeVM();
-    return 0;
+    return status;
 }
@@ -0,0 +1,27 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_ALLOCPROFILE_H
+#define SIEWLANGC_ALLOCPROFILE_H
+
+#include <stdio.h>
+
+#include "common.h"
+
+// The allocation profiler: while it is on, every time reallocate() grows something, the bytes are charged
+// to the allocation site (see ENTER_ALLOCATION_SITE in memory.h), the opcode running and its source line.
+// Compiling has no opcode, so those are charged to the line the parser is at.
+// Off, the only cost is one branch in reallocate().
+extern bool allocationProfiling;
+
+void startAllocationProfile();
+void stopAllocationProfile();
+
+// called by reallocate(), only while profiling and only when newSize > oldSize
+void recordAllocation(size_t oldSize, size_t newSize);
+
+// The top allocators (by bytes), the totals per site, and what the heap is made of right now.
+void writeAllocationProfile(FILE* file);
+
+#endif //SIEWLANGC_ALLOCPROFILE_H
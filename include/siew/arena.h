@@ -0,0 +1,41 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_ARENA_H
+#define SIEWLANGC_ARENA_H
+
+#include <stddef.h>
+
+#include "siew/common.h"
+
+// An arena is a bump allocator: we grab big blocks from reallocate() and hand out pieces of them
+// by just moving a pointer. Nothing is freed one by one, the whole thing is released at once.
+// Perfect for things that are born and die together, like the buffers of a chunk we compile,
+// run once and throw away.
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t capacity;
+    size_t used;
+    // The block comes from malloc, so it is aligned for anything (max_align_t, 16 bytes on x86-64).
+    // Without this data would start right after the 24 bytes above, only 8 aligned.
+    _Alignas(max_align_t) uint8_t data[];
+} ArenaBlock;
+
+typedef struct {
+    ArenaBlock* blocks; // the head is the block we are currently bumping into
+} Arena;
+
+// Same idea as GROW_ARRAY, but the memory comes from the arena.
+// A NULL arena means "no arena", and then this is just GROW_ARRAY.
+#define ARENA_GROW_ARRAY(arena, type, pointer, oldCount, newCount) \
+    (type*)arenaReallocate(arena, pointer, sizeof(type) * (oldCount), \
+        sizeof(type) * (newCount))
+
+void initArena(Arena* arena);
+void* arenaAllocate(Arena* arena, size_t size);
+void* arenaReallocate(Arena* arena, void* pointer, size_t oldSize, size_t newSize);
+void resetArena(Arena* arena);
+void freeArena(Arena* arena);
+
+#endif //SIEWLANGC_ARENA_H
@@ -0,0 +1,39 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_ARRAY_H
+#define SIEWLANGC_ARRAY_H
+
+#include "common.h"
+
+/*
+ * The bulk kernels behind numeric arrays (ObjArray in object.h). They work on plain double buffers, so the VM
+ * calls them once per operator instead of dispatching once per element, and a host can use them directly.
+ *
+ * With AVX2 they go 4 doubles at a time, with just SSE2 (every x86-64) 2 at a time, and a scalar loop does the rest.
+ * Which one is decided when compiling, like the scanner's fast paths (build with -mavx2 to get the wide one).
+ *
+ * Elementwise: out[i] = a[i] op b[i]. out can be a or b, but must not overlap them any other way.
+ * The masks are 1 where the comparison holds and 0 where it doesn't (a NaN never holds), so they can be
+ * multiplied or summed like any other array.
+ */
+void arrayAdd(double* out, const double* a, const double* b, int count);
+void arraySubtract(double* out, const double* a, const double* b, int count);
+void arrayMultiply(double* out, const double* a, const double* b, int count);
+void arrayDivide(double* out, const double* a, const double* b, int count);
+void arrayLessMask(double* out, const double* a, const double* b, int count);
+void arrayGreaterMask(double* out, const double* a, const double* b, int count);
+void arrayEqualMask(double* out, const double* a, const double* b, int count);
+
+// Reductions. The vector versions add in a different order than the scalar loop, so sum and dot can differ from
+// it in the last bits. min and max skip NaNs, unless the first element is one. Empty arrays: 0 for sum and dot, NaN for min and max.
+double arraySum(const double* values, int count);
+double arrayDot(const double* a, const double* b, int count);
+double arrayMin(const double* values, int count);
+double arrayMax(const double* values, int count);
+
+// the scalar loops are the reference, we keep them around to compare against
+void setArrayVectorized(bool enabled);
+
+#endif //SIEWLANGC_ARRAY_H
@@ -5,40 +5,18 @@
 #ifndef SIEWLANGC_CHUNK_H
 #define SIEWLANGC_CHUNK_H
 
+#include <string.h>
+
 #include "common.h"
+#include "opcodes.h"
 #include "value.h"
 
+// Which instructions a chunk holds: the stack VM's (OpCode) or the three-address ones (RegisterOpCode).
+// The compiler emits whatever the chunk says, and the VM runs each kind with its own loop.
 typedef enum {
-    OP_CONSTANT, // TODO: THIS CONSTANT ONLY HAS ONE BYTE (255) OPERANT. THAT'S TOO LITTLE. IMPLEMENT A 24-BIT ONE.
-    OP_NIL,
-    OP_TRUE,
-    OP_FALSE,
-    // TODO: Implement "not equal", "greater-equal" and "less-equal" as standalone operations.
-    // These operators cannot be desugared using logical negations of other comparisons.
-    //
-    // Relying on equivalences such as a <= b  being implemented as !(a > b) breaks IEEE 754 rules.
-    // Under IEEE 754, any comparison involving a NaN operand returns false. This means:
-    //
-    //   NaN <= b   => false
-    //   NaN > b    => false
-    //
-    // If we implement <= as the negation of >, we incorrectly get:
-    //
-    //   NaN <= b   → !(false) → true   // WRONG
-    //
-    // To remain compliant, each operator must be implemented independently instead of derived
-    // from the result of another comparison.
-    OP_EQUAL,
-    OP_GREATER,
-    OP_LESS,
-    OP_ADD,
-    OP_SUBTRACT,
-    OP_MULTIPLY,
-    OP_DIVIDE,
-    OP_NOT,
-    OP_NEGATE,
-    OP_RETURN
-} OpCode;
+    BACKEND_STACK,
+    BACKEND_REGISTER,
+} Backend;
 
 typedef struct{
     int count;
@@ -46,11 +24,55 @@ typedef struct{
     uint8_t* code;
     int* lines; // TODO: THIS IS A WASTE OF MEMORY, FIND A BETTER SOLUTION
     ValueArray constants;
+    Arena* arena; // where code, lines and constants come from, NULL means the normal heap
+    int maxStack; // the most values this code ever has on the stack at once, the VM makes room for them before running it
+    bool verified; // the code is known to be safe to run unchecked: it came from our compiler or passed verifyChunk()
+    Backend backend; // BACKEND_STACK unless someone sets it before compiling. For register code, maxStack is the frame
 } Chunk;
 
+// the operand of OP_NUMBER, it has no alignment so we can't just cast the pointer
+static inline double readInlineNumber(const uint8_t* operand) {
+    double value;
+    memcpy(&value, operand, sizeof(double));
+    return value;
+}
+
+// the operand of OP_INT, same story
+static inline int32_t readInlineInt(const uint8_t* operand) {
+    int32_t value;
+    memcpy(&value, operand, sizeof(int32_t));
+    return value;
+}
+
+// a register operand, a frame slot (see FOR_EACH_REGISTER_OPCODE). Unaligned and in the host's byte order, like
+// OP_NUMBER's double: one load instead of putting two bytes together
+static inline int readRegisterOperand(const uint8_t* operand) {
+    uint16_t slot;
+    memcpy(&slot, operand, sizeof(slot));
+    return slot;
+}
+
+static inline void writeRegisterOperand(uint8_t* operand, int slot) {
+    uint16_t value = (uint16_t)slot;
+    memcpy(operand, &value, sizeof(value));
+}
+
 void initChunk(Chunk* chunk);
+void initChunkInArena(Chunk* chunk, Arena* arena, int sourceLength);
 void freeChunk(Chunk* chunk);
 void writeChunk(Chunk* chunk, uint8_t byte, int line);
 int addConstant(Chunk* chunk, Value value);
 
+// what opcodes.h says about an opcode
+const char* opName(uint8_t instruction); // "OP_ADD"..., NULL for bytes that are not an opcode
+OperandKind opOperandKind(uint8_t instruction);
+int opOperandCount(uint8_t instruction); // bytes after the opcode
+int opStackInputs(uint8_t instruction); // values it needs on the stack
+int opStackEffect(uint8_t instruction); // values pushed minus values popped
+
+// same for the register opcodes
+const char* registerOpName(uint8_t instruction); // "R_ADD"..., NULL for bytes that are not an opcode
+RegisterForm registerOpForm(uint8_t instruction);
+int registerOperandCount(uint8_t instruction); // bytes after the opcode
+
 #endif //SIEWLANGC_CHUNK_H
\ No newline at end of file
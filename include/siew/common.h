@@ -12,6 +12,52 @@
 #include "siew/common.h"
 
 //#define DEBUG_PRINT_CODE
+// the build can turn the trace off (see SIEW_TRACE_EXECUTION in CMakeLists.txt), benchmarks with it are meaningless
+#ifndef SIEW_NO_TRACE_EXECUTION
 #define DEBUG_TRACE_EXECUTION
+#endif
+
+// count every opcode (and opcode pair) the VM runs, and write the counts at freeVM() (see SIEW_PROFILE_OPCODES in CMakeLists.txt)
+#ifdef SIEW_PROFILE_OPCODES
+#define DEBUG_PROFILE_OPCODES
+#endif
+
+// Tells the C compiler some code can't be reached, so it can drop the checks that lead to it
+#if defined(__GNUC__)
+#define SIEW_UNREACHABLE() __builtin_unreachable()
+#elif defined(_MSC_VER)
+#define SIEW_UNREACHABLE() __assume(0)
+#else
+#define SIEW_UNREACHABLE() do {} while (false)
+#endif
+
+// Inlines a function even when the C compiler thinks it's too big. With a constant argument,
+// every call site gets its own copy of the function, specialized for that constant.
+#if defined(__GNUC__)
+#define SIEW_ALWAYS_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define SIEW_ALWAYS_INLINE __forceinline
+#else
+#define SIEW_ALWAYS_INLINE inline
+#endif
+
+// *result = a op b on int32_t, true if it overflowed (and then *result is garbage). One instruction and a flag
+// check with GCC and clang, the 64-bit version for everybody else.
+#if defined(__GNUC__)
+#define SIEW_ADD_OVERFLOW(a, b, result) __builtin_add_overflow(a, b, result)
+#define SIEW_SUB_OVERFLOW(a, b, result) __builtin_sub_overflow(a, b, result)
+#define SIEW_MUL_OVERFLOW(a, b, result) __builtin_mul_overflow(a, b, result)
+#else
+static inline bool siewFitsInt32(int64_t value, int32_t* result) {
+    *result = (int32_t)value;
+    return value < INT32_MIN || value > INT32_MAX;
+}
+#define SIEW_ADD_OVERFLOW(a, b, result) siewFitsInt32((int64_t)(a) + (b), result)
+#define SIEW_SUB_OVERFLOW(a, b, result) siewFitsInt32((int64_t)(a) - (b), result)
+#define SIEW_MUL_OVERFLOW(a, b, result) siewFitsInt32((int64_t)(a) * (b), result)
+#endif
+
+// collect garbage on every allocation, the best way to find objects we forgot to keep reachable
+//#define DEBUG_STRESS_GC
 
 #endif //SIEWLANGC_COMMON_H
\ No newline at end of file
@@ -4,8 +4,14 @@
 
 #ifndef SIEWLANGC_COMPILER_H
 #define SIEWLANGC_COMPILER_H
+#include <stdio.h>
+
 #include "vm.h"
 
 bool compile(const char* source, Chunk* chunk);
+bool compileFile(FILE* file, Chunk* chunk);
+void abortCompilation();
+void markCompilerRoots();
+int compilingLine(); // the line the parser is at, 0 when we are not compiling
 
 #endif //SIEWLANGC_COMPILER_H
\ No newline at end of file
@@ -6,6 +6,7 @@
 #define SIEWLANGC_MEMORY_H
 
 #include "siew/common.h"
+#include "siew/value.h"
 /*
  * this is why the allocation of new memory in the array
  * is consider to be O(1) and not O(n). Because we are
@@ -28,7 +29,21 @@
 // how much memory is still being used.
 #define FREE(type, pointer) reallocate(pointer, sizeof(type), 0)
 
+// Who is asking for memory, for the allocation profiler (see allocprofile.h). NULL when nobody said.
+// A site covers everything allocated until it is left, except what an inner site claims for itself:
+// the intern table growing under copyString is "table growth", not "copyString".
+extern const char* allocationSite;
+
+#define ENTER_ALLOCATION_SITE(name) \
+    const char* enclosingSite = allocationSite; \
+    allocationSite = (name)
+
+#define LEAVE_ALLOCATION_SITE() (allocationSite = enclosingSite)
+
 void* reallocate(void* pointer, size_t oldSize, size_t newSize);
+void markObject(Obj* object);
+void markValue(Value value);
+void collectGarbage();
 void freeObjects();
 
 #endif //SIEWLANGC_MEMORY_H
\ No newline at end of file
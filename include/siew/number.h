@@ -0,0 +1,23 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_NUMBER_H
+#define SIEWLANGC_NUMBER_H
+
+#include "common.h"
+
+// enough for any double formatNumber() produces, '\0' included
+#define NUMBER_BUFFER_SIZE 32
+
+// Reads a number literal as the scanner produces them (digits, optionally a '.' and more digits).
+// The literal doesn't need to be '\0' terminated. The result is the closest double, same as strtod.
+double parseNumber(const char* start, int length);
+
+// Writes the shortest text that reads back as exactly the same double, and returns its length.
+int formatNumber(double value, char* buffer);
+
+// Same text formatNumber() gives for the double with this value, without going through the double.
+int formatInteger(int32_t value, char* buffer);
+
+#endif //SIEWLANGC_NUMBER_H
@@ -29,14 +29,30 @@
 #define IS_STRING(value)       isObjType(value, OBJ_STRING)
 
 #define AS_STRING(value)       ((ObjString*)AS_OBJ(value))
-#define AS_CSTRING(value)      (((ObjString*)AS_OBJ(value))->chars)
+// Careful: a string may be a rope or a slice, so asking for a C string can flatten/copy it (and allocate).
+#define AS_CSTRING(value)      (stringChars(AS_STRING(value)))
+
+#define IS_ARRAY(value)        isObjType(value, OBJ_ARRAY)
+#define AS_ARRAY(value)        ((ObjArray*)AS_OBJ(value))
 
 typedef enum {
     OBJ_STRING,
+    OBJ_ARRAY,
 } ObjType;
 
+// OBJ_ARRAY is the last type
+#define OBJ_TYPE_COUNT (OBJ_ARRAY + 1)
+
+// How the bytes of a string are stored. Both kinds are still OBJ_STRING, the rest of the VM should not care.
+typedef enum {
+    STRING_FLAT, // owns a NUL-terminated chars buffer
+    STRING_ROPE, // just a "left + right" node, chars is NULL until someone looks at the contents
+    STRING_SLICE, // chars points inside the buffer of parent, it is NOT NUL-terminated
+} StringKind;
+
 struct Obj {
     ObjType type;
+    bool isMarked; // reached by the garbage collector in the current collection
     Obj* next;
 };
 
@@ -66,16 +82,58 @@ struct Obj {
 
 struct ObjString {
     Obj obj;
+    StringKind kind;
     int length;
     char* chars;
-    uint32_t hash;
+    uint32_t hash; // only valid if hashed is true, use stringHash() to get it
+    bool hashed;
+    bool interned; // true if this is THE instance stored in vm.strings for its contents
+    ObjString* left;  // rope children, NULL for flat strings
+    ObjString* right;
+    ObjString* parent; // the string whose buffer a slice borrows, NULL for the other kinds
 };
 
+// A fixed-size run of doubles, stored unboxed right after the header (one allocation, no Values, nothing
+// for the GC to trace). The bulk operations on them are in array.h.
+typedef struct {
+    Obj obj;
+    int count;
+    double values[];
+} ObjArray;
+
+// what an array of count elements takes, header included. freeObject() gives back the same
+static inline size_t arrayBytes(int count) {
+    return sizeof(ObjArray) + sizeof(double) * (size_t)count;
+}
+
 ObjString* takeString(char* chars, int length);
 
 ObjString* copyString(const char* chars, int length);
+ObjString* copyStringHashed(const char* chars, int length, uint32_t hash);
+// NULL if the result would be longer than INT_MAX chars
+ObjString* concatenateStrings(ObjString* a, ObjString* b);
+// length chars of string from start, sharing its bytes. NULL if they don't all fall inside string.
+ObjString* sliceString(ObjString* string, int start, int length);
+char* stringChars(ObjString* string);
+uint32_t stringHash(ObjString* string);
+ObjString* internString(ObjString* string);
+bool stringsEqual(ObjString* a, ObjString* b);
+// The elements of newArray() are left uninitialized. Both return NULL if count is negative.
+ObjArray* newArray(int count);
+ObjArray* copyArray(const double* values, int count);
+bool arraysEqual(ObjArray* a, ObjArray* b);
 void printObject(Value value);
 
+// FNV-1a. It lives here because the scanner uses it too, it hashes lexemes while they are still hot.
+static inline uint32_t hashString(const char* chars, int length) {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < length; i++) {
+        hash ^= (uint8_t)chars[i];
+        hash *= 16777619;
+    }
+    return hash;
+}
+
 static inline bool isObjType(Value value, ObjType type) {
     return IS_OBJ(value) && AS_OBJ(value)->type == type;
 }
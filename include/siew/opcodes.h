@@ -0,0 +1,142 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_OPCODES_H
+#define SIEWLANGC_OPCODES_H
+
+#include "common.h"
+
+// What follows an opcode in the code
+typedef enum {
+    OPERAND_NONE,
+    OPERAND_CONSTANT, // one byte, an index into the chunk's constants
+    OPERAND_INT8, // one signed byte, the value itself
+    OPERAND_INT32, // four bytes, a signed int in the host's byte order (see readInlineInt())
+    OPERAND_DOUBLE, // the 8 bytes of a double, in the host's byte order (see readInlineNumber())
+} OperandKind;
+
+/*
+ * Every opcode, and everything the rest of the VM needs to know about it, in one list:
+ *
+ *   X(name, operand, inputs, effect)
+ *
+ * operand is what comes after the opcode (an OperandKind), inputs is how many values it needs on the stack,
+ * and effect is the values it pushes minus the values it pops.
+ *
+ * The OpCode enum, opName() and friends, the stack depth the compiler keeps for maxStack, the verifier's
+ * rules and the disassembler all come from here. A new opcode is a line in this list, plus its case in
+ * run() and runCachedLoop(), plus whatever the compiler emits it for.
+ *
+ * About the comparisons: "not equal", "greater-equal" and "less-equal" still have no opcodes of their own,
+ * the compiler builds them with OP_NOT. That breaks IEEE 754, any comparison with a NaN is false:
+ *
+ *   NaN <= b   => false
+ *   NaN > b    => false
+ *
+ * so implementing <= as the negation of > gives NaN <= b → !(false) → true, which is WRONG.
+ * TODO: each one needs its own opcode.
+ *
+ * TODO: OP_CONSTANT ONLY HAS ONE BYTE (255) OPERAND. THAT'S TOO LITTLE. IMPLEMENT A 24-BIT ONE.
+ * Numbers don't go through the constants: OP_SMALL_INT covers the integers in [-128, 127]
+ * (most literals: 0, 1, 2, 10...), OP_INT the rest of the ints and OP_NUMBER carries any other double in the code.
+ * The first two push ints (see INT_VAL).
+ */
+#define FOR_EACH_OPCODE(X) \
+    X(OP_CONSTANT,  OPERAND_CONSTANT, 0,  1) \
+    X(OP_SMALL_INT, OPERAND_INT8,     0,  1) \
+    X(OP_INT,       OPERAND_INT32,    0,  1) \
+    X(OP_NUMBER,    OPERAND_DOUBLE,   0,  1) \
+    X(OP_NIL,       OPERAND_NONE,     0,  1) \
+    X(OP_TRUE,      OPERAND_NONE,     0,  1) \
+    X(OP_FALSE,     OPERAND_NONE,     0,  1) \
+    X(OP_EQUAL,     OPERAND_NONE,     2, -1) \
+    X(OP_GREATER,   OPERAND_NONE,     2, -1) \
+    X(OP_LESS,      OPERAND_NONE,     2, -1) \
+    X(OP_ADD,       OPERAND_NONE,     2, -1) \
+    X(OP_SUBTRACT,  OPERAND_NONE,     2, -1) \
+    X(OP_MULTIPLY,  OPERAND_NONE,     2, -1) \
+    X(OP_DIVIDE,    OPERAND_NONE,     2, -1) \
+    X(OP_NOT,       OPERAND_NONE,     1,  0) \
+    X(OP_NEGATE,    OPERAND_NONE,     1,  0) \
+    X(OP_RETURN,    OPERAND_NONE,     1, -1)
+
+#define OPCODE_ENUM(name, operand, inputs, effect) name,
+#define OPCODE_PLUS_ONE(name, operand, inputs, effect) + 1
+
+typedef enum {
+    FOR_EACH_OPCODE(OPCODE_ENUM)
+} OpCode;
+
+// how many opcodes there are, bytes from OP_COUNT up are not opcodes
+enum { OP_COUNT = 0 FOR_EACH_OPCODE(OPCODE_PLUS_ONE) };
+
+#undef OPCODE_ENUM
+#undef OPCODE_PLUS_ONE
+
+typedef struct {
+    const char* name; // "OP_ADD"...
+    OperandKind operand;
+    int operandBytes;
+    int inputs;
+    int effect;
+} OpcodeInfo;
+
+// indexed by opcode, only OP_COUNT entries: check the byte before looking it up
+extern const OpcodeInfo opcodeInfo[OP_COUNT];
+
+// How the operands of a register instruction are laid out (see FOR_EACH_REGISTER_OPCODE)
+typedef enum {
+    REGISTER_BINARY, // dst, a, b
+    REGISTER_UNARY, // dst, src
+    REGISTER_LOAD_NUMBER, // dst, then the 8 bytes of a double (like OP_NUMBER's)
+    REGISTER_RETURN, // src
+} RegisterForm;
+
+/*
+ * The register backend (BACKEND_REGISTER in chunk.h): the same expressions, as three-address instructions.
+ *
+ *   X(name, form, stackOp)
+ *
+ * stackOp is the stack opcode it does the work of, that's how the compiler picks it.
+ * Every operand is two bytes (see readRegisterOperand()), a slot of the frame the VM sets up in vm.stack
+ * before running: the chunk's constants come first, copied in, and the registers after them. So a source
+ * operand doesn't care if it reads a constant or a register, there is no "load constant" instruction,
+ * and "1 + 2 * 3" is two instructions instead of six. The frame is chunk->maxStack slots, and a dst is always a register.
+ * R_NUMBER is only for when the constants (the first 32768 slots) are full.
+ */
+#define FOR_EACH_REGISTER_OPCODE(X) \
+    X(R_ADD,      REGISTER_BINARY,      OP_ADD) \
+    X(R_SUBTRACT, REGISTER_BINARY,      OP_SUBTRACT) \
+    X(R_MULTIPLY, REGISTER_BINARY,      OP_MULTIPLY) \
+    X(R_DIVIDE,   REGISTER_BINARY,      OP_DIVIDE) \
+    X(R_EQUAL,    REGISTER_BINARY,      OP_EQUAL) \
+    X(R_GREATER,  REGISTER_BINARY,      OP_GREATER) \
+    X(R_LESS,     REGISTER_BINARY,      OP_LESS) \
+    X(R_NOT,      REGISTER_UNARY,       OP_NOT) \
+    X(R_NEGATE,   REGISTER_UNARY,       OP_NEGATE) \
+    X(R_NUMBER,   REGISTER_LOAD_NUMBER, OP_NUMBER) \
+    X(R_RETURN,   REGISTER_RETURN,      OP_RETURN)
+
+#define REGISTER_OPCODE_ENUM(name, form, stackOp) name,
+#define REGISTER_OPCODE_PLUS_ONE(name, form, stackOp) + 1
+
+typedef enum {
+    FOR_EACH_REGISTER_OPCODE(REGISTER_OPCODE_ENUM)
+} RegisterOpCode;
+
+enum { REGISTER_OP_COUNT = 0 FOR_EACH_REGISTER_OPCODE(REGISTER_OPCODE_PLUS_ONE) };
+
+#undef REGISTER_OPCODE_ENUM
+#undef REGISTER_OPCODE_PLUS_ONE
+
+typedef struct {
+    const char* name; // "R_ADD"...
+    RegisterForm form;
+    int operandBytes;
+    OpCode stackOp;
+} RegisterOpcodeInfo;
+
+extern const RegisterOpcodeInfo registerOpcodeInfo[REGISTER_OP_COUNT];
+
+#endif //SIEWLANGC_OPCODES_H
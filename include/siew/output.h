@@ -0,0 +1,53 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_OUTPUT_H
+#define SIEWLANGC_OUTPUT_H
+
+#include <stdio.h>
+
+#include "common.h"
+
+#define OUTPUT_BUFFER_SIZE (64 * 1024)
+
+typedef struct {
+    const char* chars;
+    size_t length;
+} OutputSlice;
+
+typedef struct OutputSink OutputSink;
+
+// Where the bytes finally go. It gets them as a list of slices, to be written in that order and in one go if it can.
+typedef void (*OutputWriteFn)(OutputSink* sink, const OutputSlice* slices, int count);
+
+// Everything the VM prints goes into the sink's buffer, and only reaches the destination when the buffer is full
+// or someone flushes (the VM does at the end of every interpret(), and before reporting a runtime error).
+struct OutputSink {
+    OutputWriteFn write;
+
+    FILE* file; // file sinks
+
+    // capture sinks, everything ever written (after a flush). Host memory, it doesn't count in the VM heap
+    char* captured;
+    size_t capturedLength;
+    size_t capturedCapacity;
+
+    size_t count;
+    char buffer[OUTPUT_BUFFER_SIZE];
+};
+
+void initFileSink(OutputSink* sink, FILE* file);
+void initCaptureSink(OutputSink* sink);
+void freeOutputSink(OutputSink* sink); // flushes what is pending, the file (if any) is not closed
+
+void writeOutput(OutputSink* sink, const char* chars, size_t length);
+void writeOutputv(OutputSink* sink, const OutputSlice* slices, int count);
+void printOutput(OutputSink* sink, const char* format, ...);
+void flushOutput(OutputSink* sink);
+
+// Flushes, then returns everything a capture sink got so far ('\0' terminated). resetCapturedOutput() forgets it
+const char* capturedOutput(OutputSink* sink, size_t* length);
+void resetCapturedOutput(OutputSink* sink);
+
+#endif //SIEWLANGC_OUTPUT_H
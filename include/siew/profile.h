@@ -0,0 +1,51 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_PROFILE_H
+#define SIEWLANGC_PROFILE_H
+
+#include <stdio.h>
+
+#include "chunk.h"
+
+// What the interpreter loops ran, to decide which superinstructions and quickened forms are worth it.
+// Only counted in builds with DEBUG_PROFILE_OPCODES (see SIEW_PROFILE_OPCODES in CMakeLists.txt).
+typedef struct {
+    uint64_t executed[OP_COUNT];
+    uint64_t pairs[OP_COUNT][OP_COUNT]; // [first][second]: second ran right after first, in the same chunk
+    uint64_t typeErrors[OP_COUNT]; // runs that stopped because the operands had the wrong type
+    uint64_t addStrings; // OP_ADD that concatenated, the rest of OP_ADD (minus its errors) added numbers
+    int previous; // the opcode that ran last, OP_COUNT at the start of a chunk
+} OpcodeProfile;
+
+#ifdef DEBUG_PROFILE_OPCODES
+
+extern OpcodeProfile opcodeProfile;
+
+#define PROFILE_START() (opcodeProfile.previous = OP_COUNT)
+#define PROFILE_INSTRUCTION(instruction) \
+    do { \
+        opcodeProfile.executed[instruction]++; \
+        if (opcodeProfile.previous != OP_COUNT) opcodeProfile.pairs[opcodeProfile.previous][instruction]++; \
+        opcodeProfile.previous = (instruction); \
+    } while (false)
+#define PROFILE_TYPE_ERROR(instruction) (opcodeProfile.typeErrors[instruction]++)
+#define PROFILE_ADD_STRINGS() (opcodeProfile.addStrings++)
+
+#else
+
+// compiled out: not even the arguments are evaluated
+#define PROFILE_START() do {} while (false)
+#define PROFILE_INSTRUCTION(instruction) do {} while (false)
+#define PROFILE_TYPE_ERROR(instruction) do {} while (false)
+#define PROFILE_ADD_STRINGS() do {} while (false)
+
+#endif
+
+// The counts, most executed first. json picks a JSON object instead of the tables.
+// They do nothing when the profile is compiled out.
+void writeOpcodeProfile(FILE* file, bool json);
+void resetOpcodeProfile();
+
+#endif //SIEWLANGC_PROFILE_H
@@ -0,0 +1,27 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_SAMPLER_H
+#define SIEWLANGC_SAMPLER_H
+
+#include <stdio.h>
+
+#include "common.h"
+
+#define SAMPLER_DEFAULT_HZ 997 // not 1000, so we don't tick in step with anything that runs every millisecond
+
+// A sampling profiler: a timer interrupts the process every 1/hz seconds of CPU time, and the signal handler
+// writes down the source line and opcode vm.ip is at. Per instruction, the only cost is keeping vm.ip
+// up to date (see runCachedSampled()), the rest is the handler's, hz times a second.
+// POSIX only (setitimer + SIGPROF), elsewhere startSampling() returns false.
+bool startSampling(int hz);
+void stopSampling();
+
+// The samples as folded stacks ("script;line:12;OP_ADD 42"), the input of flamegraph.pl and friends
+void writeFoldedSamples(FILE* file, const char* scriptName);
+
+// what the VM is doing, for samples that don't land in bytecode
+void markCompiling(bool compiling);
+
+#endif //SIEWLANGC_SAMPLER_H
@@ -5,6 +5,8 @@
 #ifndef SIEWLANGC_SCANNER_H
 #define SIEWLANGC_SCANNER_H
 
+#include <stdio.h>
+
 #include "siew/common.h"
 
 typedef enum {
@@ -34,9 +36,41 @@ typedef struct {
     const char* start; // this means that we must stick with the file string during the whole execution
     int length;
     int line;
+    uint32_t hash; // hash of the string contents (0 for other tokens). So the compiler doesn't hash them again
 } Token;
 
+#define TOKEN_BATCH 512
+
+// The scanner doesn't hand tokens one by one to the parser, it fills this buffer in batches.
+// One array per field (struct of arrays): the parser mostly looks at types, and those are packed
+// one byte each. And since the next tokens are already scanned, looking ahead is just an index.
+typedef struct {
+    const char* base; // where the batch's first token starts. Offsets are from here, not from the source
+    int count;
+    uint8_t types[TOKEN_BATCH];
+    uint32_t offsets[TOKEN_BATCH]; // where the lexeme starts, from base (a batch never spans more than 4 GiB)
+    int lengths[TOKEN_BATCH];
+    int lines[TOKEN_BATCH];
+    uint32_t hashes[TOKEN_BATCH];
+    const char* messages[TOKEN_BATCH]; // only for TOKEN_ERROR, the error is not in the source
+} TokenBuffer;
+
 void initScanner(const char* source);
-Token scanToken();
+void initScannerFile(FILE* file);
+void freeScannerFile();
+void setScannerVectorized(bool enabled);
+Token scanToken(); // only for sources that are entirely in memory, streaming needs scanTokens
+void scanTokens(TokenBuffer* buffer, Token* keep);
+
+// rebuilds the Token the parser expects from the columns of the buffer
+static inline Token tokenAt(const TokenBuffer* buffer, int index) {
+    Token token;
+    token.type = (TokenType)buffer->types[index];
+    token.start = token.type == TOKEN_ERROR ? buffer->messages[index] : buffer->base + buffer->offsets[index];
+    token.length = buffer->lengths[index];
+    token.line = buffer->lines[index];
+    token.hash = buffer->hashes[index];
+    return token;
+}
 
 #endif //SIEWLANGC_SCANNER_H
\ No newline at end of file
@@ -0,0 +1,47 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_STATS_H
+#define SIEWLANGC_STATS_H
+
+#include <stdio.h>
+
+#include "common.h"
+#include "object.h"
+
+// Counters the VM keeps all the time, for a host that wants to know what it is doing without a profiler.
+// Each one is a single add in the place that already does the work, so they are always on.
+// liveObjects is a gauge (what is alive right now), resetStats() leaves it alone. The rest count since the last reset.
+typedef struct {
+    uint64_t instructions; // opcodes executed, by both loops
+    uint64_t allocations; // reallocate() calls that grew something
+    uint64_t allocatedBytes;
+    uint64_t freedBytes;
+    uint64_t peakBytes; // the most vm.bytesAllocated has been, a reset starts it again from what is alive
+    uint64_t collections;
+    uint64_t liveObjects[OBJ_TYPE_COUNT];
+    uint64_t chunks; // chunks run
+    uint64_t codeBytes; // of all the chunks run, maxCodeBytes is the biggest one
+    uint64_t maxCodeBytes;
+    uint64_t constants;
+    uint64_t maxConstants;
+} VMStats;
+
+// A copy of the counters, plus what can only be computed by looking at the VM (and is too slow to keep updated)
+typedef struct {
+    VMStats counters;
+    size_t liveBytes; // vm.bytesAllocated
+    int internCount; // live strings in the intern table, without tombstones
+    int internTombstones;
+    int internCapacity;
+    double internLoadFactor; // (count + tombstones) / capacity, what decides when it grows
+    double internAverageProbe; // entries looked at per lookup
+    uint64_t internLookups;
+} StatsSnapshot;
+
+void snapshotStats(StatsSnapshot* snapshot);
+void resetStats();
+void writeStatsJson(FILE* file, const StatsSnapshot* snapshot);
+
+#endif //SIEWLANGC_STATS_H
@@ -18,6 +18,9 @@ typedef struct {
     int count;
     int capacity;
     Entry* entries;
+    // for the stats (see stats.h): probes / lookups is how many entries a lookup looks at, on average
+    uint64_t lookups;
+    uint64_t probes;
 } Table;
 
 void initTable(Table* table);
@@ -27,5 +30,6 @@ void tableAddAll(Table* from, Table* to);
 ObjString* tableFindString(Table* table, const char* chars, int length, uint32_t hash);
 bool tableGet(Table* table, ObjString* key, Value* value);
 bool tableDelete(Table* table, ObjString* key);
+void tableRemoveWhite(Table* table);
 
 #endif //SIEWLANGC_TABLE_H
\ No newline at end of file
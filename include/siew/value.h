@@ -5,6 +5,7 @@
 #ifndef SIEWLANGC_VALUE_H
 #define SIEWLANGC_VALUE_H
 #include "common.h"
+#include "arena.h"
 
 typedef struct Obj Obj;
 typedef struct ObjString ObjString;
@@ -13,6 +14,7 @@ typedef enum {
     VAL_BOOL,
     VAL_NIL,
     VAL_NUMBER,
+    VAL_INT, // also a number for the language, see INT_VAL
     VAL_OBJ
 } ValueType;
 
@@ -25,6 +27,7 @@ typedef struct {
     union  {
        bool boolean;
        double number;
+       int64_t integer; // an int32_t (see AS_INT), in 64 bits so an INT_VAL writes the whole payload
        Obj* obj;
     } as;
 } Value;
@@ -35,22 +38,36 @@ typedef struct {
 #define NUMBER_VAL(value)   ((Value){VAL_NUMBER, {.number = value}})
 #define OBJ_VAL(object)     ((Value){VAL_OBJ, {.obj = (Obj*)object}})
 
+// Integer literals, and what +, - and * make of two ints while the result fits, are ints instead of doubles:
+// the arithmetic is one integer instruction and printing them doesn't need the double formatter.
+// Nobody can tell: an int is always exactly the double it stands for, IS_NUMBER() is true for both,
+// and whatever could come out different from the double (overflow, division, -0) gives a double instead.
+#define INT_VAL(value)      ((Value){VAL_INT, {.integer = value}})
+
 //then, we need to read the dynamic value to make it static so C can understand it
 #define AS_BOOL(value)    ((value).as.boolean)
-#define AS_NUMBER(value)  ((value).as.number)
+#define AS_NUMBER(value)  valueAsNumber(value) // ints too, converted
+#define AS_INT(value)     ((int32_t)(value).as.integer)
 #define AS_OBJ(value)     ((value).as.obj)
 
 // Now, since we are accessing directly the union part of the memory, we must take care that we are asking
 // and saving the right type, so we don't fuck things up.
 #define IS_BOOL(value)    ((value).type == VAL_BOOL)
 #define IS_NIL(value)     ((value).type == VAL_NIL)
-#define IS_NUMBER(value)  ((value).type == VAL_NUMBER)
+#define IS_NUMBER(value)  ((value).type == VAL_NUMBER || (value).type == VAL_INT)
+#define IS_INT(value)     ((value).type == VAL_INT)
 #define IS_OBJ(value)     ((value).type == VAL_OBJ)
 
+// a function and not a macro, so AS_NUMBER(pop()) still pops once
+static inline double valueAsNumber(Value value) {
+    return value.type == VAL_INT ? (double)value.as.integer : value.as.number;
+}
+
 typedef struct {
     int capacity;
     int count;
     Value* values;
+    Arena* arena; // where values comes from, NULL means the normal heap
 } ValueArray;
 
 bool valuesEqual(Value a, Value b);
@@ -0,0 +1,23 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#ifndef SIEWLANGC_VERIFIER_H
+#define SIEWLANGC_VERIFIER_H
+
+#include "chunk.h"
+
+typedef struct {
+    int offset; // the instruction that failed
+    const char* message;
+} VerifyError;
+
+// Checks everything run() takes for granted: every opcode exists, its operands are inside the code, constant
+// indexes are inside the pool, the stack never underflows or goes deeper than chunk->maxStack, and the code
+// ends in an OP_RETURN. Register code gets the checks runRegisters() needs instead, and its frame (maxStack)
+// can't be bigger than what a two bytes operand reaches.
+// On success the chunk is marked verified, and stack code gets its maxStack lowered to the depth it really reaches,
+// so a chunk that claims a huge one doesn't get a huge stack. error can be NULL.
+bool verifyChunk(Chunk* chunk, VerifyError* error);
+
+#endif //SIEWLANGC_VERIFIER_H
@@ -4,10 +4,22 @@
 
 #ifndef SIEWLANGC_VM_H
 #define SIEWLANGC_VM_H
+#include <setjmp.h>
+#include <stdio.h>
+
 #include "chunk.h"
+#include "output.h"
+#include "stats.h"
 #include "table.h"
 
-#define STACK_MAX 256 // More than this and: "Nice stackoverflow. Nerd."
+// The stack starts with this many slots, and grows before running a chunk that needs more (chunk->maxStack).
+// push() and pop() never check, the compiler already told us how deep the code goes.
+#define STACK_MIN 256
+
+typedef enum {
+    INTERN_EAGER, // every runtime string is hashed and interned as soon as it is created
+    INTERN_LAZY,  // runtime strings are hashed/interned only when they are used as table keys
+} InternPolicy;
 
 // this is a stack base virtual machine
 typedef struct {
@@ -19,10 +31,27 @@ typedef struct {
     // the reason why this is a pointer is that is faster to point in the middle of a list of bytes
     // the byte we want, than look up a list with an integer index.
     uint8_t* ip; // the name means Instruction Pointer.
-    Value stack[STACK_MAX];
+    Value* stack;
     Value* stackTop; // we point at the position past the top, that way we can say: point -> index 0 = empty
+    int stackCapacity;
     Table strings;
+    InternPolicy internPolicy;
+    bool cacheRegisters; // run with ip, stackTop and the top value in locals (the default) instead of in the VM
+    Backend backend; // what interpret() compiles to, BACKEND_STACK unless the host asks (see setBackend())
+    bool sampling; // a sampling profiler is reading vm.ip (see sampler.h), so it has to be kept up to date
+    Arena compileArena; // chunk buffers of the current interpret() call, reset after every run
     Obj* objects; // the head of the list of objects allocated in the heap.
+    OutputSink* output; // everything the program prints, stdout unless the host sets another sink
+
+    size_t bytesAllocated; // everything that went through reallocate() and is still alive
+    size_t heapLimit; // 0 means no limit. Going over it collects garbage first, then it is a runtime error
+    jmp_buf* outOfMemoryJump; // where reallocate() bails out to when we run out of memory, NULL if nobody can catch it
+
+    int grayCount;
+    int grayCapacity;
+    Obj** grayStack; // objects reached by the GC whose references are not traced yet
+
+    VMStats stats; // see stats.h
 } VM;
 
 typedef enum {
@@ -33,9 +62,20 @@ typedef enum {
 
 extern VM vm;
 
+// The sampler's signal handler (see sampler.h) can read vm.chunk and vm.ip between any two of our instructions.
+// Nothing else in the thread reads them back, so plain stores could be delayed, merged or dropped by the C
+// compiler. The ones the handler relies on go through volatile, and it reads them the same way.
+#define VM_PUBLISH_CHUNK(value) (*(Chunk* volatile*)&vm.chunk = (value))
+#define VM_PUBLISH_IP(value) (*(uint8_t* volatile*)&vm.ip = (value))
+
 void initVM();
 void freeVM();
 InterpretResult interpret(const char* source);
+InterpretResult interpretFile(FILE* file);
+InterpretResult interpretChunk(Chunk* chunk);
+void setOutputSink(OutputSink* sink);
+void setRegisterCaching(bool enabled);
+void setBackend(Backend backend);
 void push(Value value);
 Value pop();
 
@@ -0,0 +1,152 @@
+// Arithmetic: one long sum of small nested expressions, ints and decimals mixed.
+// Nothing but number literals, OP_ADD/SUBTRACT/MULTIPLY/DIVIDE and OP_NEGATE.
+(50 * ((590.2 - 859.3) / (95787 * 84))) + -((442.37 - 61) - (19 - 80)) + (((52 - 12) / 880.51) - 59) + ((2 / (9 + 698.97)) + ((55166 + 428.77) + (56 * 696.93)))
+    + -((88 - 43695) / (11 - (29 - 31))) + 158.64 + 121.58 + -(((36519 * 76) - (665.23 / 802.10)) + ((88 / 41339) * 81211))
+    + 636.76 + (((61 / 24) / 61) / 94907) + (((64 * 76986) - (22 / 84)) / 36509) + ((45.68 * (501.9 + 24)) * ((58533 + 108.39) / (913.41 / 381.66)))
+    + -45 + (9553 + ((3 - 55) + (95369 * 956.36))) + 62915 + (((631.69 * 165.32) + (197.86 * 33)) * 34)
+    + (((12.48 - 54) / (26 + 48)) + 12) + (((94 + 468.85) + (895.89 + 92307)) + 280.58) + -((659.12 / (48 + 69128)) - (82 * (95 + 29))) + -(36222 * ((33 - 75) + (10 + 663.19)))
+    + (((39 + 98909) + 70) - 11) + (((51635 * 13) + (61 / 64289)) * 15) + -44704 + 634.68
+    + (((90 / 13) / 563.13) + ((44 / 54) / 56)) + (88 - 52) + -(814.54 * ((58 / 243.62) + 7)) + -(((608.47 / 33809) * (9 - 56)) / 59)
+    + (((161.63 / 81) + 62182) - ((92 / 161.7) + 5218)) + 71 + -(46867 * (59392 * 1)) + (((426.44 - 3) * 606.82) / (79 - 789.22))
+    + (35 - (658.34 * (5 / 770.83))) + (((767.77 / 55) - (72715 * 923.76)) + (61825 * (78 - 342.11))) + (17831 - ((842.42 - 74) - (799.78 + 63))) + -(6 * ((425.68 + 840.89) + (71 + 83)))
+    + ((82 - (85 / 34)) + (55875 * (147.69 - 878.90))) + (69.52 * (28 * (11 + 426.27))) + -(((995.24 / 74888) / (25 / 81)) / 30460) + (((30 + 66) * 23848) - ((93063 - 44991) / (31 * 86)))
+    + -(((221.86 * 91) * (53 * 734.2)) - 18003) + (((181.83 / 22) + (485.59 - 2082)) + 95) + (((89 + 58) / (53410 + 78)) / (65 / (91 / 27))) + ((1 / (37 + 82)) + ((18 * 929.68) - (491.62 * 33)))
+    + 688.49 + -(((81.50 + 961.89) + (3 + 70)) + 3698) + 268.57 + 388.54
+    + 15652 + -(((25521 * 57195) + (48 * 374.80)) + 27) + (83 - (50 + (69 * 6))) + (((7 - 74170) + (82375 + 39)) - ((22 * 252.54) + 91391))
+    + 540.96 + ((54 / (29 + 24)) / ((260.69 + 23) / 915.81)) + (((97 / 13016) * (44 * 534.25)) / ((479.15 * 216.77) - (31 * 38))) + 27
+    + -((36 / (24617 * 54)) - 55) + ((200.58 - (35665 - 334.4)) * 544.1) + (((73 + 30) - 57837) + 237.8) + -34
+    + ((373.78 + 97) + ((81 / 40) - 65995)) + -(309.57 + ((92 / 35379) / (73 - 93))) + ((79 * (81 / 98171)) + ((303.9 * 70270) * (762.84 / 87))) + (((63 - 58) + 3.74) + 59599)
+    + -(((291.67 + 79629) * (27283 / 97512)) - ((25 * 77) + (32743 / 66))) + 36786 + (47590 / 23) + -(((83 / 59) - (40526 * 60)) + (65859 / (755.5 + 81662)))
+    + 601.28 + (753.92 + 27) + -((25 + (84473 * 655.25)) + 712.89) + -921.75
+    + 869.85 + (((54614 - 69277) + 97388) * ((84441 / 95802) + (871.63 / 5))) + (16 + ((285.44 + 9) - 27)) + 77060
+    + (((94862 + 49761) - 41) - 83) + 773.84 + ((19 - (31 / 880.77)) / ((8 + 986.50) / (1 / 69471))) + ((110.69 - (169.76 * 94)) + ((89 - 445.30) / (46 - 940.4)))
+    + -242.81 + (((64 * 69226) - 72) + ((88 - 50) + (19 / 81))) + -6008 + 15
+    + (30 - ((56 - 91.44) - (801.56 + 748.53))) + 73 + 99255 + (((227.54 * 524.87) / 284.85) - ((470.53 * 670.75) + (23 / 92)))
+    + 70 + 40 + -(945.43 + (74 - (89 + 478.68))) + -(((42 * 22672) + (978.82 + 303.58)) / (87 * 29788))
+    + -(348.87 * ((46 - 76841) * (49 * 53))) + (98 + ((44 / 71) - 75)) + (58 - (23 / (16 * 65771))) + -66
+    + -((84 - 23) * ((529.19 - 39) - (43 + 325.64))) + (((191.54 + 66) / 484.93) + (19 - (53 - 20))) + 200.49 + 22116
+    + -84503 + ((45864 / 29) / ((28 - 26228) - (56 / 28729))) + 25677 + (11 * ((39.69 / 77358) + 94))
+    + -(((71 + 924.65) * (96 / 87845)) * ((93 / 4) * (133.87 + 63620))) + -((29365 - (25 - 45)) - (808.32 - (62 * 17))) + (704.59 - ((26 - 73008) / 450.90)) + (((740.62 * 51) - (561.8 + 509.29)) / 56108)
+    + (((1 + 72554) + (40 * 88)) * ((78975 * 620.77) * (32 / 73))) + 14 + (((24 / 5) + (594.68 + 32)) + 810.69) + (((54 * 46.47) - 32) * ((93 + 979.78) - 79))
+    + -(61.22 * ((647.9 / 62) + (16922 - 77))) + (((295.97 / 624.32) / (275.14 / 84)) + (15400 - (58 + 112.81))) + -55281 + 32
+    + (76751 - (35 * 48948)) + (976.14 - 605.71) + (((213.44 + 53447) + 6) * ((118.72 - 84) * (49.29 - 39))) + -(((66 / 40) + (93 - 6)) / 76)
+    + 97858 + (((89 + 31117) / 436.23) + 60) + -(730.59 / ((73689 / 17037) - (218.20 - 65.61))) + -(77 - ((85895 + 47) + (78507 * 28465)))
+    + (((65 / 796.21) / (594.27 / 107.77)) + 51) + (((31 / 69435) / 720.61) + (84547 + 34)) + (((66 / 54) / 75417) / ((34 / 29656) * (467.46 / 78674))) + (((30 - 68) * 99) / ((62 + 13) / (50 / 66)))
+    + (((88778 / 80) + (57110 + 262.19)) - 40) + 943.6 + (727.48 * ((351.29 / 63466) * 84)) + -(((24 * 21) * (1794 * 80866)) / 66)
+    + ((61807 / 14399) + 47324) + (((23753 - 894.42) + (680.95 / 26)) / ((77 * 185.10) / (63 * 51))) + -((82 / 633.33) * ((69 - 52) + 20)) + (((44 / 93) + (64 - 62)) * (38 / (494.15 + 168.84)))
+    + 68 + -((68314 * (78342 / 69)) * 57) + (((96 + 314.70) / (11 * 262.7)) / ((148.31 - 91) * (44.69 - 603.5))) + ((23944 + 72) + ((62 - 14) * (98 * 20587)))
+    + 95508 + (75 + (15 + (54.81 + 28))) + -(7 + 93) + (((12607 + 12431) + 27) + ((34540 / 68) * (118.55 + 42)))
+    + -682.3 + 80 + (34 / ((38 * 66) - 88298)) + -(((12726 + 59521) - 616.9) - ((71 - 442.83) * (57 / 56)))
+    + ((975.13 * (766.57 + 68)) + 71.50) + 53 + -24 + -((44459 / 86.76) + 59911)
+    + (((54 - 226.30) / 967.74) - (689.37 + (6 / 275.13))) + -(((48 / 114.53) * 66) - ((43 * 99) / (748.15 - 39))) + (72 * ((76421 * 330.28) / 26821)) + (((35705 + 381.27) / 746.48) + ((43 - 31) + (28273 + 10)))
+    + 960.81 + (((46 + 68) * (42622 + 54474)) * (76 + 27)) + (37 - 4) + (61 - ((336.54 * 28) + (2 - 30)))
+    + -(((90 + 71) - (86 - 602.2)) - 9) + 42 + 1 + -(22 - 246.71)
+    + (((73 - 71970) / 22) / ((29741 + 67528) * (33 * 85231))) + (661.59 * ((2 + 89) / 34)) + -968.60 + (662.87 + (47383 / 94))
+    + ((76 / (69 - 91110)) / ((38 - 98) - (78472 + 26006))) + 43 + ((31 - 83) * 65) + (((14 * 87847) / (70 + 9582)) / 460.49)
+    + 89.5 + -((10 - (62 + 662.69)) / ((41 * 56.58) - (248.94 * 25))) + 4 + (((58 / 518.90) + (39 * 23330)) - 788.33)
+    + (((25763 + 33) / 96) / 77742) + (((63 - 46) * (648.23 * 75)) + (50.81 * (319.75 - 57296))) + (13 + ((147.81 * 23) + (49316 - 49.54))) + 45
+    + -(((5 - 84473) - 106.87) * ((8 * 351.46) + (97 + 30))) + -(((50 + 222.52) - (50 - 633.15)) * 20) + (((456.33 / 61647) - (68 / 712.25)) + 93) + (94 / 15)
+    + ((89 + (79787 / 242.78)) * ((62 + 22) / (799.82 * 4))) + 117.72 + 60 + (((30 - 930.4) / (1.70 - 97)) - (38 / (0.23 - 662.26)))
+    + -(486.77 / (42 * (10441 / 121.63))) + (((47 - 1) * (30 - 78)) + (68942 - (96.40 * 24774))) + -821.46 + 57024
+    + ((20 - (67 / 424.22)) - ((292.76 / 576.13) + (66 - 126.34))) + (((72 * 581.30) / (50505 * 692.18)) - (662.16 - (1 * 67619))) + 821.94 + -(((33 * 50253) / (77570 / 261.44)) * (91 + 839.9))
+    + ((903.24 * 9) * ((11 * 419.38) + 25)) + (((57 - 473.59) - (53 - 68.57)) * ((3 / 106.41) + (38 + 47))) + (((82 - 60752) - (967.3 + 88)) - 400.8) + (((929.32 * 89491) - (772.3 / 439.64)) + (875.62 / (58800 + 74)))
+    + -(((90 * 83) * (37.17 / 159.78)) + ((4 - 937.51) + 80)) + 939.81 + 18 + (((211.22 / 54454) * (33 * 90)) + ((73 / 62991) / (78 / 29747)))
+    + (80 * ((15704 + 399.63) + (74 - 27.23))) + 99124 + (65 - 414.53) + 69
+    + 75 + -(((50 / 68) - 40) / ((32 / 150.16) * 24)) + -39 + 79654
+    + 494.96 + -(38 * ((64 * 42) / (36173 - 32868))) + 92 + -(((60356 * 963.52) * (499.56 + 62.70)) * (614.16 * (61 / 104.19)))
+    + -(31 * (124.58 / (972.26 + 958.53))) + (((8 + 23) + (70220 - 15)) - (738.23 * 638.96)) + -(((31 * 78) + 55) * 345.75) + (38 * (84 + 65905))
+    + (((717.19 + 6644) / (897.39 * 20366)) - ((338.94 - 548.44) + 90)) + 96715 + (89207 + 38) + (38497 / ((30 + 68.74) + (141.89 + 504.54)))
+    + (799.70 * 430.74) + (((20 / 383.67) - (16 - 50579)) * 42) + (50 - 83.57) + 18179
+    + (27 / (691.57 * 70187)) + -(((37562 + 18) * 17) / 4812) + (((80 + 51) - 95) - 60) + -740.38
+    + (((809.21 + 68059) / (19394 / 88)) * (78.80 + (956.20 + 55727))) + (280.19 + ((83 * 67988) * (52 + 61))) + -1 + ((37 - 59392) - 11)
+    + -((94 + 356.62) - ((20 - 27) / (81 + 70840))) + ((48284 + (37 + 73453)) / 457.82) + (((14 + 69) * (340.45 * 152.11)) + ((35 + 967.33) * (562.16 + 610.12))) + -92
+    + (9 - ((984.56 * 33) - 268.41)) + -65 + -((524.89 - (41249 * 17)) - (473.91 / 39)) + -41
+    + 15 + -(11104 + ((39 / 63012) * 67)) + (((69273 - 38) * (87296 * 54)) + ((77.82 - 472.10) * (99 - 331.47))) + (((54 + 94) + (63 - 16)) - ((76.73 / 146.41) - (17 - 45714)))
+    + (19 / ((14 - 138.75) * (33616 + 96.21))) + -95.94 + (73462 / ((21 + 52) * 760.79)) + 23940
+    + (((83 - 90) / (493.42 + 241.32)) / 59) + ((13 * (54 + 21)) + ((53077 / 73) * (141.96 / 423.25))) + 23788 + ((11819 - (15 + 868.11)) - (64150 - 72))
+    + 26 + (((511.69 - 22921) - (81 * 556.73)) / ((25057 - 625.26) * (80 + 11))) + 90 + 377.47
+    + -39 + 959.77 + (((859.42 * 60) - 46) - 99833) + (((81 / 90) - (51 + 7)) + ((841.85 - 22903) - (49 / 97184)))
+    + ((15 / (90 + 57)) * ((16 * 5572) + (52 - 739.37))) + -(375.19 / 72) + 87 + -(((22 / 527.86) / (73.1 + 55)) + 13)
+    + -(830.80 / (92 - (4 + 73272))) + (((12402 * 473.4) - (82 / 89)) + ((75326 + 66) * 52)) + (((62 / 40) - 38) + (5 * (79.24 - 81))) + (((19 / 42) * (88 * 232.38)) + ((68 / 9023) - (71329 * 928.83)))
+    + 82888 + -55830 + -97 + 61.22
+    + (((43 / 27208) * (421.9 - 293.81)) - (18757 + (365.38 + 15))) + ((34 + (501.65 * 24595)) + ((240.95 + 37) * 58)) + (((65557 + 43) - (75 + 47719)) - 77) + ((80961 * 2) / 80862)
+    + (((36395 + 57) + (67 + 64)) * ((68 - 21035) * 272.99)) + (229.26 * ((29 / 65) - (18387 + 55605))) + (415.5 * (9 + 32)) + 863.66
+    + ((91004 + (37 / 65)) + ((59 + 40.88) / (4 * 783.9))) + 81 + -(73121 / ((84 / 864.71) / (64 + 87))) + -(12 - (384.33 - (61413 + 726.32)))
+    + -374.40 + -(((83 - 65) + (57 * 39414)) - (920.21 / (3 + 940.44))) + -(57433 + (46 * (779.6 / 11411))) + 81
+    + -((881.96 - 20) + ((615.62 / 95) + (653.22 / 378.49))) + ((33 / (95007 + 860.97)) / (63 - (67 * 60))) + ((84 * 2) / (32 - 16)) + (((269.95 + 100.1) * 13036) / ((77 - 242.92) / 53))
+    + -((29988 - (668.47 + 91)) * 20) + (46 + (49169 + (66 + 49595))) + ((43661 / 93) - ((93 - 20) + (74 - 15031))) + (36004 - ((742.76 / 513.22) - 172.23))
+    + 87 + ((919.51 - 30) / ((464.99 / 43) * (78 + 393.63))) + (((13 + 82) * (235.81 + 78034)) / (84 / (16108 * 82))) + -99
+    + -19202 + (30927 / 93) + (97 * ((695.11 - 5) * (23 + 207.41))) + (115.26 / ((385.1 / 64) / (56887 + 84)))
+    + ((352.20 + (71 * 89)) - (78 / (88 - 732.29))) + ((51 * (80 / 457.64)) / (69 - (5 * 54))) + -(((7977 / 46.66) * 92) - 233.66) + 174.88
+    + -(((66068 / 605.12) / (82.47 * 17543)) / (460.28 * 16)) + (978.73 - ((192.28 - 50) + (11400 * 47))) + -(58 + 197.40) + 87
+    + 296.69 + 27 + (56 / ((849.50 + 942.86) - 39)) + (((172.84 / 14) * (58971 + 63)) + (48 - 59))
+    + (172.81 / ((47321 * 34409) - 91)) + (8 - ((18 * 19) / (66 - 28))) + 52 + (19 * (6196 / (28.67 / 61)))
+    + -(85 * ((348.76 + 997.9) / (97 + 72))) + 18 + ((84482 * (65 * 89)) / (92953 - (349.79 * 52))) + (((16404 - 700.45) - 61) + 53)
+    + 13988 + (((79 * 98) * 520.88) + ((83985 + 58) + (368.43 + 12776))) + (((19 * 7674) / (733.79 + 956.61)) / (28 - 98)) + 18579
+    + 63 + (((838.23 - 293.13) + 55540) + 84) + -(((736.46 - 354.13) - 793.73) / ((79 / 299.61) * (322.80 / 10))) + 247.55
+    + -77 + -(44661 - ((96 - 48) - 20)) + ((68 - 58) * (865.29 / (24 / 27))) + (930.48 - ((72920 / 91183) + 64846))
+    + (((73756 * 68049) * 11844) - 66) + -((25.55 + (38731 * 80)) + 3982) + ((368.93 * (54 / 50)) * ((50 - 68540) * 75)) + 50
+    + (((612.17 * 6) + 87) + (40 / (29 - 43))) + -(((875.68 / 39) / (43 - 806.24)) * ((71 + 47) + (919.1 + 20))) + (((16 / 28) - (98 / 55)) + (395.64 * 17687)) + (((21 + 24) * (54392 - 56)) - ((87545 / 68.60) + 13184))
+    + (51 / (895.33 * (7.69 * 28))) + 532.32 + 85 + (((205.28 / 71405) + (580.29 * 46)) / ((3 * 788.91) * (23681 * 90773)))
+    + ((89 * (89297 - 710.63)) / ((85 / 916.2) - (41700 + 97))) + ((54 / (931.48 * 74081)) - ((44 - 63.73) * (521.51 * 60))) + -55319 + (((17327 / 611.75) - 643.33) + (49 * (73 - 59)))
+    + (((67 * 43) - 716.78) + (187.52 + (73.50 / 54))) + (22 * ((52 * 7) / 45016)) + -((482.21 / (11 / 34560)) * ((39 / 52.33) * (673.95 / 60))) + (((48 - 17) / (78582 / 14)) * ((91 / 21) * 10))
+    + (((35336 / 294.62) + (24 * 3611)) + (316.14 + (78 * 95))) + 41 + (((726.5 + 139.88) - 349.6) / ((584.77 + 89) - 11)) + ((279.57 - 576.71) + ((37 / 785.89) - (84 / 43)))
+    + 298.58 + (((616.82 / 56027) * (165.37 / 739.14)) - 13) + ((20 / (992.61 - 44594)) / ((2 * 65355) + 45)) + 84
+    + -(((84 * 92) / 14) + ((65 + 51) / (179.51 - 987.6))) + (((299.52 - 62) * 50) * ((35 - 45) / (779.83 - 40))) + -(((71 - 77) - (33 * 647.74)) + ((31 + 86761) - (82 - 272.21))) + 207.92
+    + -(31 * ((92814 + 55) / 289.90)) + -8 + -(((11 + 36) / (114.36 + 71)) - ((584.99 * 15.74) / (262.1 - 57))) + (((16 - 81856) / (37 / 32)) * 83613)
+    + (((947.33 / 653.49) * (59 - 216.13)) + ((72 + 839.52) * 56)) + -(((60 + 65) * (947.76 * 297.70)) * ((85.25 + 392.28) + (93 * 82))) + 31498 + (29 - (435.37 / (66 * 7)))
+    + -(((12642 - 649.40) * (79 * 27)) - (2 + (334.85 - 73))) + (29 - (23754 - (62 * 879.13))) + (77 * ((436.32 / 25.1) * (42 * 67))) + (94039 / 7)
+    + ((17742 - 733.14) + ((67 / 96) * 66)) + (((37 * 19) * (485.1 + 488.79)) / (73383 + (43 * 81468))) + 55 + 423.76
+    + (924.91 - ((48 / 892.31) + 420.55)) + (762.33 + ((717.44 * 183.91) / 30)) + -56 + (86 / 832.75)
+    + (76684 * 639.63) + (72 + (331.95 - (18 * 268.39))) + (((5 * 67) - (53 / 346.71)) / ((91263 - 43563) / 82)) + ((173.68 / (75095 + 57699)) - 43)
+    + (((16.7 * 78383) * (12945 - 69)) * ((93 * 71) + (842.43 + 79))) + 34 + -((788.36 + (48468 / 28)) / 90) + -(19 * (88130 * (8 + 42.54)))
+    + (((24948 * 71) / 224.29) / ((23585 / 82) * (9 + 256.73))) + (((61 / 76588) * 20.12) / 71) + (((79 + 81) / 39) + ((155.93 - 87786) + 65137)) + -((29691 / (209.81 / 81)) * ((73 + 59) + (86 / 200.15)))
+    + (619.32 + ((78 + 14) - 190.32)) + 45.98 + -(((818.63 - 12515) + 90973) + ((5 - 19304) / 88)) + 592.95
+    + -(((63 * 24) - (32208 + 14)) + ((99848 + 19) - 508.71)) + -(((33 * 469.52) * (73 / 13)) + 9) + (((44 * 55) - 398.6) + ((29.30 + 326.33) * (71993 / 886.54))) + 46722
+    + 2.38 + -((102.90 * (6 * 131.81)) / 38) + (((19 * 89563) - (98048 - 483.72)) * ((4.40 + 883.86) / (37 - 333.31))) + ((502.12 / 947.71) * ((835.64 - 10809) / (89763 / 90689)))
+    + -((67 * (67 + 15)) + 39) + -(((4 * 96) + (18 - 39)) / 90) + -((315.56 / (72 * 10)) + 50604) + -((78596 + 33939) + ((997.59 / 467.81) * (55 - 59.29)))
+    + (((48 + 846.50) * (852.31 * 32)) - ((73 / 26) + (44 * 13883))) + ((13 - (426.81 - 60744)) - ((64 - 221.16) * (89 / 55676))) + 72 + -(71665 / (43 / 20))
+    + 9 + 98 + 15 + (86417 + (99 - (91 + 33)))
+    + (((21334 * 22) * (470.96 - 50)) * ((50 + 29074) - 20)) + 26 + -(((5362 - 550.62) / 93) * 20898) + 34
+    + -((14 / (57.67 - 73)) + ((739.88 - 712.75) * 64995)) + (((416.64 + 47) * (63.86 * 5)) - ((30 / 750.5) / 1)) + -(((68 + 139.98) + (58 - 16)) / 988.80) + -(((55 * 2) / (86 + 235.4)) + ((13128 / 59) - 29))
+    + -99 + (((62 / 48532) * (77 * 91)) + ((59098 + 95) * 70)) + (((740.20 + 388.65) - (90 * 57510)) / 41) + -(824.36 + 98253)
+    + -((4 - (917.87 - 32)) / ((8450 - 48) - (58 * 30905))) + ((725.68 * (85807 + 788.51)) / ((967.64 * 69) - (667.98 * 757.52))) + ((75.26 - (77 / 59804)) + 774.81) + -(((42 / 65429) * (92434 * 58)) * (23.93 / 19734))
+    + (((70 + 970.16) / (11 / 230.13)) / (14 / 61541)) + (((967.25 / 57) / 93) + ((40 + 24.18) * (2 / 84))) + 14.55 + (((61 * 564.51) - 463.50) / ((501.90 + 13) / (43 - 10)))
+    + ((38 * (812.27 + 59177)) + ((87 + 71104) + 14)) + -((96 * (20 - 81.59)) / 25.90) + -22.3 + ((21572 / (27565 / 557.30)) * ((85141 + 9) * (45 / 92936)))
+    + (((40 - 94) + 96) - 70) + (((996.68 - 97) * (52.54 + 90466)) + ((21 + 49) - 91539)) + -((4 * (48 * 47)) * 96) + (38 * ((10 - 60414) * (89 + 8)))
+    + (27 - 386.44) + ((52175 / (53 * 49)) + ((62 / 99) * 86937)) + -(50 / ((51815 * 69) + (56546 - 57))) + -7
+    + -821.95 + ((76.98 + (22 - 60)) / (62 / (153.58 / 63))) + 23 + -(37 / (94 / (68 / 688.66)))
+    + 258.10 + (((71 - 25) * (903.65 - 96)) / ((20 / 772.94) * (74 + 535.82))) + -((60 + 26) * ((486.22 / 37390) / (1 + 235.93))) + -83
+    + 520.39 + -(((806.89 - 23025) - (94380 / 55820)) * ((49 - 59) / (651.26 - 23))) + -((97 + 472.22) * ((42 * 10089) + 56)) + (((56 * 37) / 14) - ((94 * 743.91) - (557.1 / 47)))
+    + -(((87209 * 41) + 34447) + ((83 + 526.91) / (92 + 42278))) + -(52 / ((82258 / 339.13) - (126.54 * 28278))) + ((86120 * (5 - 352.37)) * ((19 - 2317) * (10 - 20))) + -820.46
+    + (((21 + 89425) / 57) / 88) + -(((43 / 28) / (563.89 / 16)) / ((46 / 679.70) * 87)) + (125.70 + ((69975 / 91) / (646.25 / 95712))) + -526.78
+    + -(565.67 - ((91 / 15658) / 853.3)) + (((81 - 52) - (959.89 * 43)) * ((81 / 59) + (66 + 1240))) + (79 + ((38 - 732.4) - (388.96 / 86666))) + (((25 + 47) + (303.68 + 61703)) * ((2.62 * 756.23) / (8 / 23)))
+    + 173.85 + -(((244.88 + 587.28) + 24646) / 63) + 3.78 + 20
+    + (((96 * 36613) - (42 + 98)) / 69.38) + (69224 / ((58 * 942.88) * (80 + 721.58))) + 22 + (((12094 / 731.52) + 852.19) / 993.35)
+    + (((85 / 179.50) - 517.62) + (33202 * 94)) + ((35 - (12 - 77.38)) / (76 / (36503 * 95))) + -((30 - (6550 - 452.40)) * 93) + (((82 * 9) * (31 * 612.83)) * (38716 * (9 * 5)))
+    + 278.98 + 17784 + -851.18 + -(((77 * 75) + 47) / 68)
+    + 45343 + (8623 / (441.8 + 962.35)) + (634.68 * ((250.44 - 73633) / (67 - 74))) + -50
+    + (65 + ((433.24 + 616.49) - (70 + 52.3))) + ((6 / (25252 / 88672)) - ((98 * 75) * (63759 / 486.45))) + -(59 + 61355) + -((38 - (574.46 + 93)) + ((41 * 666.16) - (21 - 77)))
+    + (558.10 - 846.10) + 81 + (((75 * 46) / 169.72) * ((344.94 / 604.34) + (10745 / 805.85))) + (35817 - ((75 * 39) * (82012 * 70843)))
+    + (((81724 + 95) * 387.55) * (854.33 + 34)) + (43 - ((8 + 352.51) * 80)) + 46606 + (((98620 + 38) * (268.97 / 99)) / ((61 * 67) + 365.40))
+    + ((50 + 89) / (15 / 56)) + -70 + (((16 * 72) + 77) / (6 + (1 + 49851))) + -(61551 + 378.87)
+    + (((52 + 16) / (68 - 90)) / (33 + (86 / 70))) + -556.2 + 75 + -(((22 - 84) * (208.1 / 98)) / ((85 / 78556) - 29))
+    + (34966 * 155.21) + -8 + -(7 * ((703.19 + 50) + (48889 - 69.2))) + 89
+    + -(52 + 433.17) + (((714.87 * 76) / (47568 - 749.56)) + ((71065 / 11) + (215.71 * 86))) + ((231.55 + (46 + 57)) - ((415.82 * 575.23) + (98 - 25))) + -(((58 * 952.85) - (4 * 73)) - (86 * (76 + 422.79)))
+    + (((87 * 84) * (80.67 - 5)) * (74 + (860.64 * 82))) + (((826.87 * 62394) - 46536) + 108.2) + (((584.89 / 36) + (959.22 + 74779)) * (37 / (728.46 * 55))) + -(((44 * 123.5) - 65) * ((25 * 445.2) + (267.5 * 14)))
+    + (82049 / ((39 * 655.10) - (704.53 + 29))) + (((70 - 24) - (45 * 96)) / (52 / (4 + 4))) + (560.16 / ((15 - 515.81) + (2508 - 718.74))) + (((528.19 + 314.87) - (67 / 61354)) + 93)
+    + ((40 + (4 * 34)) * (967.94 * (76821 - 71))) + (((4 + 15944) - (81 / 81)) - 22) + (513.67 / ((65 / 825.49) * 72247)) + (16 + 38)
+    + (574.31 - 889.39) + (6 + ((61758 * 68835) / 71)) + ((795.10 * (19 * 152.36)) * (67 * (37183 * 42))) + (((409.15 * 53588) + (35 + 907.95)) / ((460.72 / 4896) - (7 * 3181)))
+    + (49 * ((1 / 390.17) + (74 + 89))) + -18 + 20 + 84
+    + 60 + -((63 + (76 - 98)) + ((79943 / 15) * (49 - 785.84))) + -(((76 * 95) - (37 - 276.71)) / ((57 / 315.78) * 847.88)) + (((5.74 * 919.2) - (16 + 884.83)) + (645.9 + 12))
+    + -(75 - ((656.47 + 997.56) * (3 + 495.37))) + ((78 * (21 - 45.18)) * ((759.10 * 557.56) / 37006)) + (((75 - 54) / 90) - (53733 + 13)) + (((290.87 - 485.8) * (86 * 33)) + ((45 / 7) + (89 - 73375)))
+    + 72064 + -67 + 324.45 + (((50736 / 796.5) * (85 + 76727)) + 959.8)
+    + ((67 / (101.54 / 87)) - ((11 / 7) / (26810 + 57.2))) + (((653.66 * 55) - (473.40 / 373.14)) * ((31 - 19) - (4315 - 194.6))) + 26 + (((54 - 57) - (91 + 92)) * 11)
+    + (16 / (17 * (88 / 845.36))) + (((8 - 62) / 85676) + ((27 / 440.67) + 952.86)) + 27 + ((76 - (30100 + 40780)) + ((244.80 - 56) / (8 * 70)))
+    + ((55 * (30 + 27)) + (71 - (87 / 99549))) + (((389.42 + 7) / (99 * 21759)) + 90362) + (((751.31 - 698.97) / (93125 - 670.3)) * (40 + (38 * 85220))) + (((32 / 8088) * (539.17 + 11)) + 2)
+    + (((87 - 22195) - (64 + 82)) - 58083) + -689.93 + -(85422 / 24) + -(803.29 / 80)
+    + (19499 - 71) + 808.32 + (736.28 / ((55 - 525.80) * (16665 - 890.63))) + (((45 * 33572) / (81 + 37)) - (271.10 / 81))
+    + -39243 + -520.79 + 88 + ((27 - (88 + 96)) * 487.10)
+    + (((304.99 / 72) + 98) / ((417.43 / 52) - 448.23)) + -67 + (((8 / 44016) * (44 + 364.32)) - 53) + (((16845 / 60) / (942.63 / 39.88)) * (79569 + (64868 + 54677)))
+    + -(51572 + ((952.23 * 91) * (60 + 886.93))) + 8.22 + 12 + 50
+    + 81 + (((26880 - 782.62) * 32) / ((62029 / 91) - (13 - 66535))) + ((61 * (38 / 816.94)) / ((87602 * 54272) + 16)) + (12 + 73.62)
@@ -0,0 +1,302 @@
+// Comparison chains: boolean results compared to each other, left to right.
+// OP_LESS/GREATER/EQUAL and the OP_NOT the compiler adds for <=, >= and !=.
+!(25 < 430.58) == !(81302 < 633.20) == (152.82 <= 198.29) == !(47 < 88) == (774.9 > 81333)
+    == !(20 >= 51) == !(31878 != 532.36) == !(90 != 980.1) == !(17 < 187.77) == !(36 < 98)
+    == !(668.36 <= 81) == !(40 != 885.23) == !(94248 != 385.85) == !(49 < 22) == !(66 >= 77)
+    == (13388 == 39) == (33 > 139.76) == (688.79 < 26323) == (50 != 135.29) == (427.71 == 37553)
+    == (361.49 <= 2) == (82871 == 93747) == (885.6 < 90) == (44 >= 86) == (51 <= 93)
+    == !(39 != 13961) == !(51 <= 78) == (61 != 87836) == !(859.41 > 280.36) == (724.95 >= 11352)
+    == !(91 != 607.37) == (557.76 <= 68) == !(62 != 45) == !(982.59 == 904.52) == (3571 >= 115.94)
+    == (50 >= 779.86) == !(746.17 > 21543) == !(60 < 93) == (81 < 60.77) == !(13 <= 463.21)
+    == (527.50 != 5) == !(15 != 117.92) == !(71 != 532.88) == !(84894 != 70) == (524.56 < 84408)
+    == (32198 < 46) == (87 >= 33017) == !(39 == 64434) == (3 <= 45) == (962.65 < 58)
+    == (72 > 60679) == (67441 > 82) == !(60 >= 6) == !(45 == 100.68) == (136.46 > 26)
+    == (6 != 21849) == (1 == 23) == (46050 != 21) == (132.28 < 439.13) == (39481 > 98)
+    == (39844 >= 80165) == !(41448 > 11675) == (428.26 < 141.46) == !(95 > 397.99) == !(54127 != 5170)
+    == (374.64 != 607.36) == !(122.62 > 56098) == (59 > 18) == !(823.77 > 3) == !(6.37 > 99)
+    == !(55 >= 713.70) == !(9844 == 333.88) == !(25215 == 89) == (72369 != 25) == (95 >= 399.79)
+    == (511.96 < 697.22) == (975.19 == 76) == (25 != 512.34) == (73 != 41) == !(79 == 51141)
+    == !(974.37 < 42) == (245.20 == 29) == (70 <= 95) == (422.57 <= 11) == (49 > 98.11)
+    == (93 < 739.40) == (868.71 > 93011) == (102.19 <= 56) == (90 <= 5) == (36 != 52)
+    == (15 >= 5) == !(289.72 != 308.33) == (64308 == 81) == !(55 < 93488) == (35 <= 525.53)
+    == (74074 < 40) == (20 <= 87) == (7 == 34) == !(301.10 != 97) == (84 != 56)
+    == (33 != 68) == !(7 != 61.17) == (921.26 < 334.57) == !(37 > 184.20) == (71418 < 505.26)
+    == !(17 < 42736) == (21 >= 55) == (52 >= 97315) == (763.42 > 821.83) == (43082 >= 66070)
+    == (43654 >= 260.46) == (31 < 222.2) == !(94102 > 95395) == (2.21 > 54) == !(386.16 == 849.41)
+    == (14 == 77) == !(77 < 76) == (34 >= 76) == (88 < 61) == (12 != 66015)
+    == (57 == 14107) == (743.69 <= 46.46) == (354.87 < 63) == (87 > 4) == (50 == 47)
+    == !(658.92 >= 34723) == (19 == 994.83) == (13 < 613.43) == (72 < 73) == (61 > 90)
+    == (42 > 541.13) == (202.24 <= 691.10) == (414.34 != 23309) == (518.10 == 67) == !(514.63 != 484.22)
+    == (81 == 74682) == (595.27 > 87637) == (32 < 11) == (867.26 <= 497.81) == !(224.29 != 98)
+    == (375.27 < 8944) == !(9832 != 20306) == !(214.86 == 47) == !(87940 >= 748.46) == (221.43 < 379.7)
+    == !(16 < 9501) == (40 != 90) == (33 <= 56) == (23 >= 81) == (53 >= 25)
+    == (84 > 79090) == (103.82 == 96) == (32 < 71) == !(70 != 67) == (42 > 78)
+    == (77926 < 10292) == (468.85 == 14189) == (479.2 >= 86789) == (77 <= 25677) == (2239 <= 97)
+    == (64 >= 31653) == (80 > 84) == (18 <= 28) == !(77 <= 405.71) == (47 >= 92)
+    == !(302.96 == 38) == !(67 < 93) == (850.74 >= 44) == (960.1 >= 16) == (440.2 >= 86155)
+    == !(37 >= 60) == !(42 == 733.46) == (38852 >= 34) == (97.80 <= 630.92) == !(514.46 > 18695)
+    == (728.16 == 68) == !(32633 < 82545) == (14875 >= 39336) == (14 <= 86) == (13 != 7953)
+    == (31441 > 57993) == (531.25 >= 11) == !(89 > 70546) == (90299 >= 56535) == (57 != 68296)
+    == (10 < 445.60) == (1 == 4) == (44 <= 98) == (78 >= 3) == (93.24 < 91398)
+    == (70 < 61) == (27565 < 5399) == !(11508 > 36) == (63 > 2) == !(577.74 == 956.61)
+    == (93 >= 14917) == !(73637 == 80) == (571.55 >= 20) == (19633 < 50) == (63.25 < 39867)
+    == (64666 > 71) == (49 == 529.27) == !(91 >= 945.92) == !(24893 < 11) == (845.64 >= 27)
+    == (536.82 <= 26) == !(77139 <= 36) == (89 <= 93) == !(64 >= 88) == (642.12 >= 92)
+    == (64736 == 602.66) == (32580 >= 54182) == (84 <= 24) == (38 <= 11505) == (75 <= 83)
+    == (97 < 37) == (85 < 45202) == !(27915 <= 848.16) == !(18 > 74657) == !(20 < 83)
+    == !(94990 < 178.97) == (78 == 500.45) == !(97 < 495.47) == (50 <= 5) == (494.27 > 48780)
+    == !(69 >= 17) == (42297 > 272.32) == (914.91 >= 33) == (9 <= 47) == (81 < 80)
+    == (67 > 39402) == (52 < 89.46) == !(907.21 <= 122.67) == (588.9 >= 632.97) == (60 >= 38801)
+    == (20 < 579.89) == !(4 >= 60) == (97.8 >= 81) == (89 != 670.96) == (98 != 11303)
+    == (84287 <= 72) == (340.60 > 98) == (323.55 == 93053) == (72225 >= 987.39) == (50 >= 87579)
+    == (95 <= 666.76) == (84 <= 18823) == !(80 < 68) == (77 < 39460) == (60 >= 25)
+    == !(72257 >= 25) == (556.68 > 614.88) == !(96 >= 56815) == (678.96 <= 17608) == (53 >= 946.97)
+    == !(63 == 80) == (59 == 667.8) == (90 >= 78) == (483.5 > 25) == !(576.40 < 54.22)
+    == (833.93 < 958.93) == (21568 == 922.50) == (19 >= 78) == (24804 < 67413) == (24 < 871.21)
+    == (7 >= 18) == (80 < 154.85) == !(84500 < 881.9) == (61 != 605.63) == (48 == 77981)
+    == !(621.27 == 4519) == !(29 < 41564) == (615.12 < 58) == !(91499 > 81) == !(68381 > 47054)
+    == !(35 <= 4) == (48 <= 36) == !(67734 < 75809) == (20348 < 1896) == (81 < 22)
+    == !(61134 == 34315) == (20 < 323.29) == (31 >= 2.9) == (79 > 71) == (696.60 >= 88)
+    == (201.23 < 173.22) == (554.2 > 706.69) == (29363 < 98277) == (223.2 <= 46) == (57 >= 68)
+    == (379.1 <= 353.46) == (87 > 34021) == !(60 <= 38) == (51 > 59) == !(399.74 <= 99)
+    == (8 <= 145.11) == (632.47 <= 62) == !(32 >= 13) == (59130 == 16) == (115.12 != 31063)
+    == !(80 >= 406.45) == (45 == 902.36) == (17 < 4) == (28644 == 82) == !(87 != 74)
+    == !(6021 != 27573) == !(366.61 == 1) == (43.78 <= 55186) == !(483.55 <= 25) == !(29 <= 53)
+    == (97 == 89135) == (605.6 < 652.50) == (88709 >= 29) == (68 == 476.72) == (48 != 174.65)
+    == (265.36 == 89) == (52 > 33) == !(87708 >= 3) == (50 > 10) == !(133.47 < 129.27)
+    == (96 > 68670) == (72 > 44) == !(45.49 <= 457.86) == !(18 > 92) == (72 != 81)
+    == (2 == 39) == (68 > 80) == (74 != 307.39) == !(67027 <= 28797) == (52 > 989.98)
+    == (24 >= 41) == !(2 <= 173.1) == (523.10 >= 93.94) == !(45 == 548.59) == (83 == 229.55)
+    == (76646 == 53) == (50 == 13) == (87 <= 73345) == !(72 >= 51) == (41141 <= 28)
+    == (6 > 47728) == (63958 < 361.1) == (30 < 82) == (76109 == 67) == (62 > 26)
+    == (29439 >= 14) == (39 == 760.91) == (69 >= 410.14) == (19 != 942.57) == (64 == 78)
+    == (77 <= 44) == (66 > 389.29) == (64 > 806.72) == (859.16 >= 94) == (89.28 >= 91)
+    == !(79 == 605.38) == !(40 <= 530.96) == (678.5 != 278.39) == !(92 != 46196) == (30.15 == 977.85)
+    == !(614.85 != 26) == (89 != 98579) == (694.17 != 22) == (48 == 23) == (85 > 75670)
+    == (67 > 567.5) == (64.14 <= 38) == (36 == 304.13) == !(51 == 51817) == (34441 > 651.57)
+    == (65 < 877.24) == (67 >= 708.24) == (59588 <= 24) == !(43 > 13) == (12868 == 8)
+    == (702.29 < 25) == !(62 < 55) == !(810.35 <= 29201) == (71237 != 93368) == (46 <= 926.50)
+    == (29 < 29) == (724.34 > 49) == (7573 != 206.20) == (97 < 55084) == (33 != 64)
+    == (576.9 >= 65172) == (19327 <= 6) == (31039 == 365.22) == !(532.79 <= 69) == !(13 < 420.26)
+    == !(8407 > 66) == (18.95 < 82251) == (873.23 > 51) == !(335.41 == 863.41) == (60 > 10)
+    == !(59 != 98) == (61 == 72) == !(38 <= 19.40) == !(43 >= 29186) == (81 > 7)
+    == (793.23 <= 332.42) == !(657.7 > 52.8) == (78 == 49) == (483.98 >= 59) == (38 <= 8)
+    == (23 < 96) == (34 == 872.78) == (77 >= 26) == !(61247 > 10) == (461.86 < 42.84)
+    == (93 < 736.5) == (40 == 34) == !(70 < 76274) == (71 < 73) == (364.56 == 71)
+    == !(76 != 41) == (71.90 >= 92) == !(49 != 39) == (84 != 746.92) == (2 > 94)
+    == (43 > 41) == !(91 < 73) == (67 >= 85) == !(966.35 != 72788) == !(821.83 >= 27014)
+    == (437.57 >= 93) == !(24 <= 27) == (567.24 != 26) == (97519 < 93419) == (97 <= 16)
+    == (84 < 221.8) == (1 == 17) == (98 <= 63) == !(27 <= 81) == (61460 > 34)
+    == (19 <= 12758) == (66 == 65275) == !(888.10 >= 30190) == (93 == 65) == (90 != 30)
+    == (897.67 == 99) == (84264 > 58649) == (74 == 92) == (39170 >= 121.78) == (41 > 20)
+    == (60352 > 793.36) == (27 > 9) == (170.43 == 5135) == (60934 <= 34) == (349.79 <= 29352)
+    == (1 > 70) == (64 != 7) == !(73 >= 472.20) == (62 >= 85) == (96852 == 5)
+    == (10821 > 34) == (77 <= 90) == (89646 >= 565.55) == !(6 == 22) == (73 != 51743)
+    == (85 < 1) == (83 >= 82956) == (29 > 7) == !(206.73 != 44) == (66 == 60)
+    == (7 >= 57) == !(72729 == 12) == (88 != 91) == (74 >= 306.44) == (77492 == 650.9)
+    == !(76 == 98) == (8 == 47489) == (88487 < 175.31) == (30 > 276.56) == (60 >= 66)
+    == !(58 == 10) == (70.2 >= 14) == (38687 == 99) == (3 >= 597.43) == (511.22 <= 25.27)
+    == (236.33 >= 11) == (58838 >= 13398) == !(73 == 488.26) == (18 == 120.76) == (9214 < 76)
+    == (80 > 27) == !(49 > 55) == !(438.56 != 80) == (52 >= 33) == (135.57 >= 96)
+    == !(764.52 == 510.56) == (34 <= 996.87) == (18 > 489.60) == (62787 != 64) == (33 == 47)
+    == (88 >= 406.19) == !(51 < 928.65) == !(67 != 14) == !(90 < 878.60) == (53 == 997.79)
+    == (84 < 3245) == (86 <= 275.62) == (9 >= 321.7) == (68282 == 8836) == (34 != 66)
+    == (71 == 32.51) == (591.63 != 166.10) == !(78 <= 490.82) == (68 > 64) == !(14 != 413.24)
+    == (34 > 7) == !(45 > 418.35) == !(19 <= 25) == !(47 < 743.77) == !(401.83 != 7)
+    == (53 == 6) == (53124 != 462.38) == (24.85 < 36) == (477.42 > 39400) == (105.91 > 74)
+    == !(4942 >= 64) == (19 < 45) == (22 >= 953.35) == !(278.33 >= 70) == (3377 >= 61)
+    == (454.59 > 69) == !(3679 > 69809) == (764.60 >= 626.23) == (15150 > 24) == (13 <= 30)
+    == (14 > 79) == (94 != 85) == (661.87 != 16) == (969.57 != 22) == (97 > 72)
+    == !(50 <= 40686) == (103.9 >= 58) == (88 == 371.59) == (91378 > 43480) == (232.60 == 7699)
+    == (988.2 <= 80) == (38 == 18) == (83 == 71) == !(54784 > 73758) == !(31 > 366.85)
+    == !(92944 != 55868) == (37 > 31) == (260.13 <= 11) == !(95 >= 75) == (50 <= 30432)
+    == (81 != 45) == (802.45 == 189.21) == (26949 <= 497.36) == !(7.37 >= 12) == (15160 < 20796)
+    == (35 != 28) == (98591 <= 66) == (58842 < 59125) == (92 <= 29) == (498.34 == 16)
+    == (51 != 40) == !(76 != 92) == !(87 >= 448.28) == (59 >= 76) == (879.95 <= 36)
+    == (35 == 561.97) == (56 == 74279) == !(689.18 > 95999) == !(77 < 56) == !(79 > 52)
+    == !(32 == 29) == (35300 > 57) == (383.88 < 75) == !(11770 > 52) == (60 < 929.2)
+    == (9 <= 355.62) == (17087 <= 31) == !(20818 <= 45) == (74 < 54) == (439.65 == 50)
+    == (384.35 > 25) == (82 > 208.83) == (17 == 55) == (5 != 977.56) == (81 != 81326)
+    == (21 <= 996.99) == (51275 != 957.47) == !(92 != 49312) == (39 == 64) == !(252.2 <= 18)
+    == (50 > 13) == (850.19 == 901.1) == (25 > 68) == !(58 < 778.96) == !(613.88 > 58)
+    == (219.77 != 455.1) == (85 != 53) == (15 >= 8) == (52 >= 33.21) == (83905 < 592.23)
+    == (14.9 != 414.53) == (42 >= 26) == (85 >= 597.63) == (43 > 80) == (96 > 54)
+    == (461.32 <= 840.31) == !(55 != 68) == (970.68 <= 96.71) == !(597.44 > 62476) == (33 < 976.41)
+    == !(48 < 626.31) == !(4133 == 847.48) == (623.88 > 58131) == (14 == 85) == (504.83 >= 148.12)
+    == (2195 >= 27447) == (90 == 61) == (565.82 > 386.57) == (77 == 38) == (16 >= 92958)
+    == !(931.7 >= 51) == (565.80 == 43505) == !(38 > 97046) == (87 == 237.51) == (226.95 >= 30)
+    == (746.78 == 763.74) == (27 != 482.27) == (59 != 89) == (833.9 > 58) == (52937 > 24)
+    == (6 >= 77) == !(953.77 >= 89) == (69 != 41) == (35 == 44) == (94 >= 94)
+    == !(59140 != 24) == !(48 < 45324) == (64 >= 12) == (63 <= 93) == (31 <= 54812)
+    == !(30 != 38) == (48 != 891.24) == !(25947 <= 3) == !(19 > 86) == (46 != 48282)
+    == (84903 < 9) == (46 == 14) == !(52 < 4) == (952.12 > 25) == !(84.52 == 18180)
+    == (17 < 10) == (373.39 == 26) == (17 != 66) == (81 == 50) == (77 > 65)
+    == (234.68 <= 85634) == (6 > 255.51) == (78494 == 16707) == (40661 <= 18) == (93.88 < 36)
+    == (83469 != 91363) == !(411.68 <= 36) == (61902 >= 268.75) == (77 < 67) == (419.37 != 76)
+    == (51 < 81680) == (727.74 == 37258) == (87 > 74) == (771.61 < 315.43) == (71 == 717.44)
+    == (7 <= 50) == (45 >= 10) == (59 < 364.32) == (236.2 <= 96791) == (427.12 > 16465)
+    == (19.94 < 20572) == (275.79 >= 84) == (949.51 >= 65342) == (832.77 >= 882.38) == (90 > 865.14)
+    == (1690 != 41732) == !(996.11 != 164.1) == (89236 > 94.58) == (27077 < 61) == (74226 > 26)
+    == (41 == 101.75) == (11 >= 72) == (35 <= 37) == (85 <= 89) == (85132 > 477.11)
+    == (19580 < 31) == (35 > 97) == (13.41 != 84) == !(73.73 <= 61) == (49 != 59)
+    == !(90.56 != 437.19) == (87 >= 519.70) == !(33803 > 68) == !(98216 < 33434) == (37 != 170.88)
+    == (413.24 <= 11) == (31 >= 42) == !(87 <= 37) == (90 > 15) == !(803.15 == 67)
+    == (92 != 45) == (10452 <= 78) == !(19 < 71) == (20 >= 97) == !(50 >= 944.7)
+    == (21 != 36) == (968.66 > 76944) == !(59 != 30) == (30943 < 18983) == (40 >= 854.94)
+    == (62 <= 58679) == (48 >= 679.99) == !(46 > 78) == !(70355 > 346.9) == !(33 == 77)
+    == (73033 <= 17) == !(36 < 15) == !(21 >= 68) == (11 > 94) == (756.68 == 27)
+    == !(48.62 >= 301.31) == !(72 <= 90) == (54 >= 37) == !(13 >= 9449) == (47443 >= 36)
+    == !(6.31 != 513.46) == (195.3 >= 54) == (77 > 6) == (64 >= 3) == (27484 != 32)
+    == (543.98 >= 73.42) == (375.44 <= 69987) == (93363 != 21311) == !(92 != 65) == !(824.82 >= 505.69)
+    == !(77 != 27909) == (537.6 != 3018) == (17 > 76) == (113.69 > 15617) == !(72 != 95512)
+    == !(11747 > 95) == (38 >= 60) == (61550 > 81996) == !(43 <= 45) == (97 < 57)
+    == !(21944 < 517.50) == (17685 < 16) == (77 > 81) == !(223.30 <= 962.93) == (90 > 55.88)
+    == !(32 < 725.60) == (53 > 303.23) == (649.34 != 22182) == (264.58 == 406.38) == !(77 < 66)
+    == (73976 != 845.91) == (1 < 90) == (67778 > 13) == !(91 < 55) == !(563.35 < 90)
+    == !(83 != 37) == (13096 == 18) == (819.45 == 515.2) == (52 != 76) == (22872 == 23222)
+    == !(11700 < 43) == (74 >= 761.89) == (96 < 28) == !(59 <= 244.96) == !(617.43 != 68905)
+    == !(65 > 90) == !(73 == 355.93) == (80 != 28) == (3 > 30) == (43 <= 947.34)
+    == (44 <= 53) == (3 > 66) == (46 < 16) == (642.21 != 23) == (6678 <= 84)
+    == (80 >= 33) == (38 != 741.11) == (30.41 <= 38) == (23759 == 460.88) == (19 < 40396)
+    == (63 != 55798) == (16.32 >= 33) == (42 < 79) == (37 != 774.14) == (232.84 > 96841)
+    == (31 == 215.2) == !(27 >= 253.6) == (41 < 653.62) == (42 > 516.86) == (837.38 <= 28)
+    == (257.43 < 4974) == (52 <= 651.14) == (93 > 19) == (979.66 < 44) == !(94 <= 9)
+    == (26 <= 72) == (225.79 >= 40) == (78984 == 62893) == (483.68 == 17) == !(57109 == 64964)
+    == (73 >= 76) == !(809.13 != 77) == (50470 >= 9799) == !(29 == 289.14) == (8100 <= 91412)
+    == (7 <= 63) == (14 > 34) == (788.10 >= 612.92) == (62738 == 65) == (674.93 < 154.63)
+    == !(55128 == 8252) == !(117.7 < 31) == (12612 != 70499) == !(15 >= 881.14) == (30850 < 92)
+    == (29964 >= 87318) == !(861.52 < 919.51) == !(954.5 < 49) == (61 != 50) == (551.13 >= 88.71)
+    == (2584 == 62) == !(155.71 > 140.77) == !(84548 < 5) == (781.40 > 97138) == (93873 != 292.61)
+    == (41 >= 19) == (88 > 70) == (23 == 755.86) == (29 != 867.38) == !(193.10 == 46875)
+    == (94 <= 64812) == (76 >= 920.57) == (67 <= 25) == !(904.53 <= 93) == (24 >= 82)
+    == !(87 != 22) == (54516 <= 243.17) == (731.97 >= 18.60) == (358.37 != 26) == (65630 >= 95)
+    == (97434 != 99) == !(39585 <= 13) == (49 == 11) == (2 < 97) == !(46 == 42)
+    == (716.70 > 69) == (55 > 228.93) == (28 < 166.84) == (12673 == 72) == !(57 > 54)
+    == !(2 == 67415) == (11011 >= 27) == (428.39 == 56421) == (350.22 > 142.8) == (83286 > 59)
+    == !(641.12 == 2) == !(87 <= 123.41) == (11 <= 35) == (75677 == 21) == (634.98 != 2)
+    == (275.66 > 27.41) == (44 != 56) == (811.51 != 3) == !(20183 <= 20) == (307.23 <= 41)
+    == (24 > 84489) == !(500.68 >= 5) == (20 >= 8201) == !(86 >= 56) == !(473.89 > 251.94)
+    == (874.39 == 44) == (92 > 572.87) == (7 <= 116.80) == !(97 != 90) == !(78 > 47034)
+    == !(546.38 != 982.38) == (46 == 280.38) == !(561.92 < 72) == !(532.93 < 20287) == (94 == 10963)
+    == (3 > 1) == !(67099 >= 96) == (30 < 41) == (101.84 == 35) == (35 <= 29)
+    == (6 < 5) == !(16759 <= 216.46) == !(14 != 98) == (70 > 13) == (55119 == 56)
+    == (585.43 >= 12) == (280.34 <= 10) == (58857 != 10) == !(500.51 <= 55.34) == !(10 < 1)
+    == (69932 < 454.90) == (64153 >= 134.40) == (38.10 <= 9558) == (936.6 >= 88) == (2912 <= 866.22)
+    == (51 < 15) == !(69 >= 78) == (691.41 > 56) == (52 < 160.71) == (21049 >= 222.32)
+    == !(862.25 < 465.85) == (471.60 <= 49) == (14 == 353.99) == (42 != 12386) == !(37597 < 49)
+    == (516.21 > 691.74) == !(556.53 <= 95) == (20289 == 504.56) == (901.98 <= 16467) == (71 < 11)
+    == (94 < 576.55) == !(1 == 28) == (13 == 35) == (59 == 685.84) == (565.29 <= 915.60)
+    == (45 > 97884) == (52761 < 17) == !(6 < 1287) == (48309 < 56) == !(765.84 <= 17224)
+    == (832.6 < 45136) == !(256.44 != 41) == (592.56 < 12096) == (391.73 >= 60647) == (954.87 >= 64)
+    == !(11 > 7772) == (48 <= 158.82) == (252.2 == 19) == (69 == 5.1) == (153.78 == 43831)
+    == !(15 <= 826.27) == (70 < 48) == (44 <= 41279) == (327.21 != 8) == !(76 < 75)
+    == (24761 < 33) == (9 <= 628.93) == (29764 != 131.44) == (59 >= 1) == (545.31 > 65)
+    == !(61 == 34) == (15 >= 405.91) == (745.76 == 68.92) == (149.5 <= 33) == (5 > 24)
+    == (1 == 24) == (4 <= 875.18) == !(59.89 == 25362) == (2164 >= 41659) == !(31 >= 37)
+    == !(41 <= 15) == !(97117 > 1133) == (96.21 != 28) == (364.17 > 60) == (39239 <= 925.37)
+    == !(670.83 > 890.11) == (99 < 19) == !(16217 < 78700) == (21 > 70) == (1974 == 7)
+    == (73.45 >= 873.89) == (13 == 36644) == (963.54 <= 49672) == (90 == 389.75) == (33750 <= 56197)
+    == !(353.12 >= 975.24) == (16 <= 971.69) == !(36974 > 54) == (511.28 >= 25646) == (26 == 990.2)
+    == (82 >= 34) == !(697.73 > 25) == !(25 >= 99) == (2 == 55) == !(90 >= 19)
+    == (39 <= 665.70) == (29 > 76782) == !(84555 >= 91) == (32 != 46928) == (253.45 >= 85)
+    == !(96 >= 14) == (79 > 96) == (5717 <= 5.65) == (70956 > 515.20) == (56115 == 48)
+    == !(74 <= 88854) == (73 != 675.22) == !(97 > 235.88) == (821.37 != 35923) == (7 >= 41697)
+    == (505.56 == 1449) == !(42 > 16) == (547.64 < 71062) == !(79 >= 2) == (72 < 81)
+    == (267.7 >= 475.85) == (604.55 > 400.24) == (37631 == 27) == !(99 <= 613.33) == !(15 < 5)
+    == (210.31 < 592.93) == (49 == 851.35) == (579.65 != 10) == !(852.5 >= 95.95) == (98417 <= 10)
+    == !(33 <= 19080) == (55452 < 154.11) == (10221 > 66) == (71975 > 632.38) == !(17 != 394.48)
+    == !(902.87 > 22) == (69 <= 713.67) == !(81 != 94.48) == (465.45 < 68) == !(3.20 != 40)
+    == (666.45 > 53978) == (91 >= 1) == (137.25 != 72) == !(45 != 49127) == (20 == 11)
+    == (3 > 36) == (45.76 != 64) == (94 == 93) == (30800 != 96) == (85267 < 71)
+    == (23051 == 2828) == (69223 < 937.21) == (95 >= 692.68) == (49 != 526.71) == !(49 < 60782)
+    == (23 >= 5) == (74685 > 802.53) == !(80716 > 634.26) == (85 <= 83) == (389.38 >= 20942)
+    == !(992.24 == 11) == (23403 != 4) == (936.7 > 31) == !(27 <= 961.22) == !(56320 <= 43389)
+    == !(59 > 96731) == !(92127 >= 907.81) == (30193 == 6.23) == !(613.63 > 28.26) == (223.34 > 72689)
+    == (585.22 >= 39045) == (447.37 > 52) == (74 == 5) == !(5 < 67603) == (904.89 >= 29)
+    == !(996.42 != 24374) == !(39 == 95881) == !(46983 <= 60) == (73.78 < 45) == (268.36 >= 28)
+    == (741.82 <= 914.55) == !(75.35 == 84518) == (50 == 79) == (9 == 514.74) == !(43 == 326.45)
+    == !(99 >= 882.63) == (15341 <= 84) == (430.71 >= 850.91) == (30 < 16) == !(24 >= 62271)
+    == (18 > 75.12) == !(7 == 82) == !(236.20 < 207.18) == (48 != 96240) == !(33 > 53)
+    == (67 >= 53737) == (99 > 61) == !(54 == 90.88) == !(202.24 == 31.38) == !(81 > 46511)
+    == (23 != 94) == (94 <= 50) == (540.73 >= 48) == (482.62 != 78) == !(25 < 68090)
+    == !(37 == 84) == (64 == 30) == (435.55 <= 44) == !(52238 >= 39.11) == !(323.6 <= 49)
+    == (46 < 305.98) == (683.46 == 73) == (97 < 96) == (42 > 8) == (721.66 == 61)
+    == (3 != 58) == (96 != 44) == (408.22 != 59305) == (34 == 96.97) == !(30716 <= 123.52)
+    == (387.16 == 4) == (31464 == 95) == !(29 == 7) == !(87006 != 211.34) == (46207 > 71)
+    == (25904 != 68) == (34 == 388.48) == !(34 > 634.28) == !(11917 > 88) == !(30907 >= 548.60)
+    == (711.14 > 419.12) == (28358 > 52) == (41 > 8) == (627.69 > 47.37) == (14 != 27.98)
+    == (58 < 675.37) == (90469 != 64291) == (811.2 != 827.80) == (70660 == 48) == (798.17 == 57)
+    == (83 <= 111.22) == (67889 < 72) == (38.63 >= 63) == (204.80 >= 36) == !(31 > 91)
+    == !(268.28 != 90) == (52379 == 501.56) == (40 >= 35) == (19 >= 8) == (70 <= 13049)
+    == (476.76 > 42) == (35939 != 10303) == (9 < 662.39) == (71 <= 86) == !(11407 <= 52)
+    == (991.86 < 524.20) == (661.67 <= 58) == (23 == 375.28) == (967.36 >= 49) == !(94 > 710.11)
+    == (43 == 80) == (64 >= 13) == (906.5 <= 15323) == !(261.86 < 50) == (369.79 < 218.19)
+    == !(272.80 != 13696) == (44 == 50) == (207.41 != 8697) == (853.2 > 458.79) == (37 != 70)
+    == (60 > 374.86) == (1432 != 50543) == (22 >= 38) == (63072 < 562.58) == !(60 < 93)
+    == (29 >= 812.69) == (973.40 < 234.91) == !(93 > 77106) == (93747 != 79086) == (440.23 <= 6)
+    == !(70 <= 31) == (51963 == 70394) == (31081 > 52101) == (381.37 != 79) == (99551 <= 763.72)
+    == !(10 < 89) == !(6 >= 10) == !(82 > 64) == !(578.3 < 96) == !(11 < 519.28)
+    == (63 != 69) == !(945.96 > 86) == (4955 == 78.92) == (412.76 > 26) == (56 >= 41.25)
+    == (71876 < 14) == !(36 == 47) == !(94 >= 30) == (37 < 446.93) == (10 != 21)
+    == (13206 != 39) == (66301 < 88) == (647.50 > 348.75) == (22282 <= 62) == !(965.84 < 31.10)
+    == (64 >= 59119) == (59 <= 24060) == (42 != 80) == !(26 == 74) == (993.71 == 44)
+    == (45 == 37) == (35 != 1) == (36 > 35) == (6 == 50.45) == (687.66 == 53)
+    == !(84 < 112.27) == (38 > 873.89) == !(84.75 == 28) == (393.66 == 88055) == (50 != 98)
+    == (78 < 648.14) == !(42 < 582.80) == (12 <= 54) == (85 < 267.19) == (847.95 <= 953.47)
+    == (33601 >= 35) == !(841.56 >= 94) == (43.92 < 42561) == (989.31 > 2) == (98 != 975.17)
+    == !(55331 == 97169) == !(17486 >= 41864) == (26699 != 21) == !(78 < 251.48) == (2 != 231.11)
+    == !(75031 == 600.9) == (912.76 > 96805) == (14959 < 287.66) == (99 >= 926.33) == (45 != 63332)
+    == (32 != 541.42) == (88 < 82) == !(351.75 > 7) == (13908 <= 74) == !(23 <= 293.83)
+    == (25 < 49) == (25 <= 77) == (755.10 < 44371) == !(24810 != 46) == (25 >= 44)
+    == !(817.10 != 616.30) == (73 > 400.16) == !(338.64 < 90.38) == (46 <= 18) == (18 != 47)
+    == (147.81 >= 29) == (54 > 598.45) == (641.44 > 328.20) == (47 <= 31408) == (231.61 >= 96)
+    == !(804.80 == 36) == !(42 != 361.25) == (580.13 < 94) == (31 == 56694) == !(937.8 < 72)
+    == (81 <= 14668) == !(836.69 != 96) == !(64 > 34935) == (94 != 99597) == (71 > 53)
+    == (62228 == 784.47) == (49 <= 21) == (1091 >= 91891) == !(59 <= 920.67) == (78 < 51190)
+    == (81 < 74) == (51572 >= 40) == (480.73 > 982.95) == (78 >= 622.36) == (68890 < 30.39)
+    == !(876.54 <= 5) == (629.49 >= 55) == (939.31 > 386.42) == (47320 == 98) == (23916 != 19)
+    == (874.58 == 1918) == (14 != 22) == (795.8 == 73) == !(76349 != 19) == (567.99 > 77089)
+    == (298.44 > 922.49) == (68797 >= 55459) == (65 <= 902.48) == (402.61 < 87) == (52 == 483.97)
+    == (10 >= 975.86) == (666.6 == 32617) == (99259 <= 67.74) == (509.95 >= 39) == (485.53 >= 33275)
+    == !(23795 != 87) == (41784 >= 412.16) == (829.55 >= 48) == !(80 == 13252) == (50 > 875.52)
+    == !(147.90 < 76) == (42370 != 16) == !(91 > 471.30) == !(94 >= 6) == !(45 >= 80)
+    == (73 != 34) == (657.71 <= 23) == (55 > 744.60) == (709.8 >= 12) == (684.25 > 99405)
+    == (46 != 34102) == (746.49 != 6) == (329.55 > 43.65) == (26 <= 750.95) == !(75202 < 98)
+    == (88 >= 91) == !(14480 <= 264.7) == (327.78 != 797.93) == !(24 <= 529.10) == !(50 <= 47000)
+    == !(57 > 782.65) == (1 > 710.85) == (817.77 <= 410.84) == (55 < 68761) == (4 < 35182)
+    == (723.94 > 453.88) == (98 == 16) == (5.42 != 25) == (54 > 73476) == !(594.6 <= 24)
+    == (70 >= 44) == (532.23 == 51) == (75 >= 36) == (663.30 >= 79) == (18 > 675.22)
+    == !(80 <= 50627) == (21 < 1) == (44229 <= 919.40) == (525.70 >= 52) == (21 > 526.18)
+    == !(3 <= 688.30) == (61.5 > 12226) == (539.58 != 99271) == (96 == 16.42) == !(12 < 2)
+    == (785.75 <= 300.29) == (528.46 != 98164) == (65 >= 59) == (97234 != 93) == !(261.46 != 20)
+    == (40 > 753.13) == (83 >= 14) == !(32 == 88) == (86 < 3) == !(56 > 525.72)
+    == !(63918 >= 548.5) == (482.9 != 186.69) == !(55813 < 6156) == (74 > 53) == !(686.55 > 88)
+    == (82 < 13) == !(83 < 96) == (24 >= 253.98) == (61 >= 98) == (37 >= 38)
+    == (38 <= 32529) == (70099 != 41) == (88 < 509.33) == (239.11 != 59) == !(47 > 96)
+    == (53 < 56) == !(13480 != 61.87) == (5 > 65) == !(71 > 58) == (71559 < 36112)
+    == (66 > 88) == (71646 < 14867) == (33 < 145.1) == !(75618 == 476.11) == (486.79 < 652.40)
+    == !(34 >= 38) == (91 >= 56) == (61 >= 744.54) == (459.75 >= 23) == (654.61 <= 768.41)
+    == (66 != 109.13) == (20 != 370.15) == (192.95 >= 537.27) == (900.60 == 33) == (97195 >= 35)
+    == (17 > 32) == (97 != 629.90) == !(34450 == 56) == !(63713 < 54) == (915.1 != 472.29)
+    == !(48 <= 69) == !(72 > 97) == (949.96 == 61072) == !(63 <= 3105) == (55 == 62)
+    == !(19496 == 46) == (27 >= 87) == (44958 >= 250.66) == (42 > 44269) == !(29.27 >= 21)
+    == (27 == 16956) == (864.52 <= 26) == (110.57 <= 39) == (87585 < 29) == (156.30 == 77)
+    == (93 > 48) == (88 != 7) == (152.76 > 780.81) == (71363 == 91520) == (449.70 != 12)
+    == (942.66 <= 619.14) == (73 == 60) == (34868 < 19429) == (87 > 215.62) == (91065 == 45578)
+    == (39657 != 20) == (30238 != 26) == (63338 > 310.91) == (36 == 702.90) == (80 != 93)
+    == (97.35 >= 43) == !(18 == 96111) == !(632.34 <= 342.95) == (37 < 589.80) == (158.11 > 43)
+    == (28 == 29275) == (847.6 >= 25) == (569.6 >= 72) == (35 < 844.69) == (11845 > 668.20)
+    == (19 > 22218) == !(25 <= 69) == (50 <= 58) == (119.84 <= 67) == (18773 == 88273)
+    == (15 < 598.5) == !(93 >= 89) == (397.48 < 1) == !(655.5 > 5567) == (21 == 95)
+    == (802.11 >= 457.64) == (11792 == 401.12) == (849.21 > 604.19) == (10 < 8791) == (178.98 < 21928)
+    == !(2560 < 21) == (942.58 == 65620) == (48 >= 62) == !(13 != 283.61) == (248.56 > 949.61)
+    == (46 != 517.11) == (30758 < 661.74) == (64 != 63) == (374.17 <= 9628) == !(70 != 6)
+    == !(78208 >= 28) == (20 <= 60) == (3 <= 163.51) == (88 < 59) == (79 <= 722.66)
+    == !(43.43 < 77357) == !(18 < 37) == !(57 < 13) == (78 > 14404) == !(31896 >= 34)
+    == (46 != 491.45) == (411.96 != 778.77) == (26407 <= 90) == (50 <= 9) == !(59 < 72)
+    == !(19 <= 20) == (447.73 == 93) == !(479.51 == 598.75) == (57.82 <= 30) == !(27280 >= 501.92)
+    == !(26 >= 18) == (78 == 641.54) == !(74661 <= 4) == (62 <= 95346) == (20 >= 40)
+    == (82 < 29) == (21 < 677.68) == (39097 < 61) == (92 != 67) == !(69 == 24)
+    == (885.28 != 14707) == (63 > 47767) == (19039 != 76) == (66 != 34) == (191.10 > 636.26)
+    == !(85 <= 1971) == (74 <= 194.88) == (58 != 177.95) == (5690 < 2) == (51 < 11)
+    == (50729 != 34) == (634.99 == 84064) == (255.21 <= 85) == !(292.94 >= 33767) == !(32061 >= 80)
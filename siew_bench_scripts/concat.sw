@@ -0,0 +1,203 @@
+// String concatenation: 200 pieces joined, then compared with the whole text (which flattens the rope).
+// Every literal takes a constant slot, so this stays under the 256 OP_CONSTANT can address.
+("do ipsum aliqua consectetur consectetur adipiscing ut et "
+    + "sed et dolor do consectetur lorem consectetur sed "
+    + "elit labore adipiscing "
+    + "dolor ipsum dolore sed lorem magna "
+    + "ut magna do elit incididunt dolor "
+    + "eiusmod elit consectetur magna eiusmod "
+    + "aliqua consectetur sed "
+    + "magna eiusmod aliqua eiusmod labore "
+    + "labore eiusmod aliqua dolor sed "
+    + "adipiscing incididunt lorem sed et amet lorem "
+    + "et eiusmod eiusmod labore lorem "
+    + "incididunt aliqua dolore sed "
+    + "tempor do do dolore adipiscing sed dolore "
+    + "consectetur sit adipiscing adipiscing "
+    + "consectetur amet amet aliqua do et et consectetur "
+    + "incididunt dolore amet adipiscing "
+    + "ut eiusmod incididunt "
+    + "elit do aliqua dolore ut incididunt et "
+    + "lorem et amet sit sed magna "
+    + "consectetur sed magna dolor elit "
+    + "dolor incididunt eiusmod dolor lorem eiusmod "
+    + "dolore tempor ut labore ipsum sed "
+    + "et adipiscing et elit tempor tempor tempor "
+    + "consectetur incididunt consectetur incididunt elit do labore magna "
+    + "elit sed tempor consectetur et incididunt elit "
+    + "aliqua adipiscing ut et amet sit tempor "
+    + "incididunt sed aliqua elit aliqua dolor consectetur adipiscing "
+    + "labore eiusmod sed dolor et do lorem do "
+    + "sit et labore magna labore "
+    + "sed amet dolore elit dolor "
+    + "tempor sit sit consectetur sit "
+    + "tempor amet et consectetur magna "
+    + "labore elit amet eiusmod incididunt tempor "
+    + "consectetur elit amet dolor dolore elit do aliqua "
+    + "ipsum magna lorem sit dolore aliqua "
+    + "consectetur do amet aliqua aliqua "
+    + "dolore tempor et incididunt "
+    + "adipiscing elit amet labore sit aliqua "
+    + "do labore magna amet eiusmod tempor "
+    + "ut do labore adipiscing incididunt ut "
+    + "tempor magna ipsum "
+    + "aliqua labore tempor "
+    + "ut magna dolore "
+    + "dolor consectetur sed ipsum aliqua consectetur "
+    + "dolore eiusmod ipsum "
+    + "ut dolor elit magna labore "
+    + "ut amet amet "
+    + "elit aliqua labore "
+    + "lorem sed ipsum ipsum "
+    + "ipsum ipsum magna consectetur "
+    + "amet ipsum tempor ipsum labore incididunt magna sed "
+    + "elit do elit lorem "
+    + "magna do sed incididunt eiusmod dolore do tempor "
+    + "elit amet tempor lorem amet "
+    + "ut ipsum magna incididunt do adipiscing magna "
+    + "dolor amet lorem et labore "
+    + "lorem consectetur dolor "
+    + "labore ut tempor ut et "
+    + "ipsum ut et consectetur dolor aliqua "
+    + "labore amet consectetur "
+    + "consectetur do do eiusmod ut magna incididunt "
+    + "adipiscing dolor sed adipiscing magna aliqua aliqua magna "
+    + "lorem ut sit sed labore adipiscing do incididunt "
+    + "adipiscing sed lorem "
+    + "ipsum amet tempor amet elit tempor lorem "
+    + "elit consectetur incididunt sed do et tempor "
+    + "amet consectetur magna eiusmod lorem ut "
+    + "sit et do elit consectetur magna amet amet "
+    + "sit ut dolore magna dolore consectetur "
+    + "dolor dolore et lorem labore et aliqua aliqua "
+    + "ut ut dolor incididunt et "
+    + "incididunt ut et consectetur dolore et "
+    + "eiusmod ipsum consectetur consectetur sed magna "
+    + "do tempor sed "
+    + "ut ipsum labore do "
+    + "dolore do elit ipsum ipsum dolore et elit "
+    + "consectetur do ut consectetur et et "
+    + "et tempor adipiscing "
+    + "eiusmod consectetur incididunt "
+    + "adipiscing amet sed do lorem "
+    + "do sit dolore "
+    + "ut elit adipiscing "
+    + "consectetur ut adipiscing tempor "
+    + "et tempor sit aliqua adipiscing magna do "
+    + "ut dolor eiusmod elit ut "
+    + "labore adipiscing magna ipsum do ut "
+    + "sit labore et ut sed consectetur aliqua lorem "
+    + "et incididunt et aliqua sed dolore dolor tempor "
+    + "elit amet ipsum aliqua "
+    + "eiusmod elit adipiscing amet adipiscing sit "
+    + "dolor lorem ipsum incididunt amet sed sit sit "
+    + "amet consectetur dolore "
+    + "elit et consectetur et aliqua adipiscing "
+    + "tempor tempor aliqua do lorem dolore "
+    + "dolore ipsum eiusmod "
+    + "adipiscing dolore ipsum consectetur amet "
+    + "do eiusmod labore sit tempor et sit sit "
+    + "aliqua amet do tempor "
+    + "aliqua sed labore "
+    + "sit magna amet "
+    + "sit ipsum incididunt "
+    + "lorem labore dolor dolore ipsum do labore "
+    + "ut amet do sed dolore eiusmod et "
+    + "dolore amet dolore aliqua "
+    + "et elit incididunt et incididunt amet dolor "
+    + "magna consectetur elit elit sed dolor "
+    + "dolore sit dolore adipiscing elit sed "
+    + "adipiscing et adipiscing "
+    + "tempor dolor dolor tempor sed amet "
+    + "magna ipsum elit incididunt "
+    + "aliqua incididunt consectetur aliqua et "
+    + "tempor eiusmod aliqua ipsum "
+    + "lorem aliqua dolor dolor "
+    + "sit ut do incididunt incididunt "
+    + "consectetur dolor consectetur ipsum ipsum "
+    + "et elit sed dolore sit magna tempor "
+    + "ipsum labore consectetur aliqua dolor "
+    + "sit tempor sed magna ut sed adipiscing dolor "
+    + "incididunt labore sit do lorem "
+    + "adipiscing sit tempor "
+    + "et sed magna elit tempor "
+    + "ut et lorem sit eiusmod eiusmod "
+    + "adipiscing labore lorem elit "
+    + "dolor amet et dolore tempor "
+    + "lorem labore do labore sed dolore "
+    + "amet lorem et dolor do "
+    + "magna tempor magna sit sit "
+    + "magna consectetur magna "
+    + "adipiscing ut adipiscing incididunt ut do consectetur "
+    + "dolor incididunt eiusmod ut tempor "
+    + "amet ut magna dolore lorem "
+    + "aliqua et ipsum "
+    + "tempor elit eiusmod "
+    + "ipsum tempor sit magna dolor amet "
+    + "incididunt magna consectetur eiusmod "
+    + "adipiscing ipsum sit dolor amet lorem ipsum elit "
+    + "eiusmod do et amet sit aliqua sed "
+    + "incididunt lorem ut elit aliqua lorem elit "
+    + "sed aliqua tempor consectetur "
+    + "consectetur adipiscing consectetur "
+    + "sed adipiscing et incididunt magna ut dolor "
+    + "consectetur lorem dolore ut ut magna tempor dolore "
+    + "sit dolor dolore incididunt "
+    + "magna sed ipsum adipiscing do lorem "
+    + "eiusmod elit et aliqua "
+    + "dolore labore elit aliqua amet do "
+    + "magna eiusmod et elit "
+    + "et elit labore "
+    + "magna et consectetur et ut dolore aliqua lorem "
+    + "ipsum labore magna incididunt aliqua "
+    + "dolor amet lorem consectetur magna "
+    + "tempor dolore labore "
+    + "elit dolor incididunt "
+    + "magna do tempor amet tempor adipiscing incididunt "
+    + "consectetur ipsum consectetur sed adipiscing labore "
+    + "tempor consectetur eiusmod sit sit tempor eiusmod do "
+    + "ut do sit "
+    + "ut magna ut amet lorem "
+    + "amet amet ipsum labore adipiscing lorem "
+    + "et consectetur ipsum do tempor dolore eiusmod "
+    + "ut magna lorem "
+    + "do magna ut adipiscing ut amet consectetur consectetur "
+    + "eiusmod ipsum ipsum adipiscing aliqua lorem lorem "
+    + "magna lorem sed eiusmod "
+    + "ipsum do lorem "
+    + "aliqua ipsum ipsum dolore labore eiusmod dolor "
+    + "adipiscing elit et sed adipiscing adipiscing adipiscing "
+    + "magna amet magna eiusmod aliqua "
+    + "dolor dolor labore do aliqua elit "
+    + "dolore amet eiusmod tempor "
+    + "amet aliqua tempor consectetur tempor do labore "
+    + "ut tempor ipsum elit sit "
+    + "consectetur elit sed "
+    + "incididunt dolore et sit amet sit dolor tempor "
+    + "sed elit et eiusmod ipsum et et incididunt "
+    + "dolore aliqua et eiusmod do et elit aliqua "
+    + "consectetur aliqua adipiscing dolor adipiscing amet eiusmod adipiscing "
+    + "labore sit dolor tempor amet "
+    + "dolore eiusmod consectetur et magna tempor incididunt lorem "
+    + "eiusmod ipsum sed lorem consectetur "
+    + "dolor ipsum et aliqua "
+    + "tempor tempor dolore sit labore dolore adipiscing dolore "
+    + "labore tempor et et dolore aliqua tempor "
+    + "aliqua sit consectetur elit eiusmod ut "
+    + "incididunt incididunt labore tempor sed amet amet "
+    + "et dolor lorem do dolor amet "
+    + "et tempor adipiscing sit tempor "
+    + "sit dolor elit "
+    + "magna magna sed labore "
+    + "dolore eiusmod elit labore elit "
+    + "consectetur incididunt magna consectetur do ipsum "
+    + "magna lorem eiusmod tempor sit ut "
+    + "ipsum dolore lorem et dolore "
+    + "ipsum aliqua lorem dolore adipiscing "
+    + "sed aliqua ipsum dolore "
+    + "elit et adipiscing ut ipsum sed ut tempor "
+    + "et dolore consectetur sit eiusmod dolor et do "
+    + "tempor do eiusmod "
+    + "amet sit dolore incididunt sit sed ut dolor "
+    + "sed sit labore elit ")
+    == "do ipsum aliqua consectetur consectetur adipiscing ut et sed et dolor do consectetur lorem consectetur sed elit labore adipiscing dolor ipsum dolore sed lorem magna ut magna do elit incididunt dolor eiusmod elit consectetur magna eiusmod aliqua consectetur sed magna eiusmod aliqua eiusmod labore labore eiusmod aliqua dolor sed adipiscing incididunt lorem sed et amet lorem et eiusmod eiusmod labore lorem incididunt aliqua dolore sed tempor do do dolore adipiscing sed dolore consectetur sit adipiscing adipiscing consectetur amet amet aliqua do et et consectetur incididunt dolore amet adipiscing ut eiusmod incididunt elit do aliqua dolore ut incididunt et lorem et amet sit sed magna consectetur sed magna dolor elit dolor incididunt eiusmod dolor lorem eiusmod dolore tempor ut labore ipsum sed et adipiscing et elit tempor tempor tempor consectetur incididunt consectetur incididunt elit do labore magna elit sed tempor consectetur et incididunt elit aliqua adipiscing ut et amet sit tempor incididunt sed aliqua elit aliqua dolor consectetur adipiscing labore eiusmod sed dolor et do lorem do sit et labore magna labore sed amet dolore elit dolor tempor sit sit consectetur sit tempor amet et consectetur magna labore elit amet eiusmod incididunt tempor consectetur elit amet dolor dolore elit do aliqua ipsum magna lorem sit dolore aliqua consectetur do amet aliqua aliqua dolore tempor et incididunt adipiscing elit amet labore sit aliqua do labore magna amet eiusmod tempor ut do labore adipiscing incididunt ut tempor magna ipsum aliqua labore tempor ut magna dolore dolor consectetur sed ipsum aliqua consectetur dolore eiusmod ipsum ut dolor elit magna labore ut amet amet elit aliqua labore lorem sed ipsum ipsum ipsum ipsum magna consectetur amet ipsum tempor ipsum labore incididunt magna sed elit do elit lorem magna do sed incididunt eiusmod dolore do tempor elit amet tempor lorem amet ut ipsum magna incididunt do adipiscing magna dolor amet lorem et labore lorem consectetur dolor labore ut tempor ut et ipsum ut et consectetur dolor aliqua labore amet consectetur consectetur do do eiusmod ut magna incididunt adipiscing dolor sed adipiscing magna aliqua aliqua magna lorem ut sit sed labore adipiscing do incididunt adipiscing sed lorem ipsum amet tempor amet elit tempor lorem elit consectetur incididunt sed do et tempor amet consectetur magna eiusmod lorem ut sit et do elit consectetur magna amet amet sit ut dolore magna dolore consectetur dolor dolore et lorem labore et aliqua aliqua ut ut dolor incididunt et incididunt ut et consectetur dolore et eiusmod ipsum consectetur consectetur sed magna do tempor sed ut ipsum labore do dolore do elit ipsum ipsum dolore et elit consectetur do ut consectetur et et et tempor adipiscing eiusmod consectetur incididunt adipiscing amet sed do lorem do sit dolore ut elit adipiscing consectetur ut adipiscing tempor et tempor sit aliqua adipiscing magna do ut dolor eiusmod elit ut labore adipiscing magna ipsum do ut sit labore et ut sed consectetur aliqua lorem et incididunt et aliqua sed dolore dolor tempor elit amet ipsum aliqua eiusmod elit adipiscing amet adipiscing sit dolor lorem ipsum incididunt amet sed sit sit amet consectetur dolore elit et consectetur et aliqua adipiscing tempor tempor aliqua do lorem dolore dolore ipsum eiusmod adipiscing dolore ipsum consectetur amet do eiusmod labore sit tempor et sit sit aliqua amet do tempor aliqua sed labore sit magna amet sit ipsum incididunt lorem labore dolor dolore ipsum do labore ut amet do sed dolore eiusmod et dolore amet dolore aliqua et elit incididunt et incididunt amet dolor magna consectetur elit elit sed dolor dolore sit dolore adipiscing elit sed adipiscing et adipiscing tempor dolor dolor tempor sed amet magna ipsum elit incididunt aliqua incididunt consectetur aliqua et tempor eiusmod aliqua ipsum lorem aliqua dolor dolor sit ut do incididunt incididunt consectetur dolor consectetur ipsum ipsum et elit sed dolore sit magna tempor ipsum labore consectetur aliqua dolor sit tempor sed magna ut sed adipiscing dolor incididunt labore sit do lorem adipiscing sit tempor et sed magna elit tempor ut et lorem sit eiusmod eiusmod adipiscing labore lorem elit dolor amet et dolore tempor lorem labore do labore sed dolore amet lorem et dolor do magna tempor magna sit sit magna consectetur magna adipiscing ut adipiscing incididunt ut do consectetur dolor incididunt eiusmod ut tempor amet ut magna dolore lorem aliqua et ipsum tempor elit eiusmod ipsum tempor sit magna dolor amet incididunt magna consectetur eiusmod adipiscing ipsum sit dolor amet lorem ipsum elit eiusmod do et amet sit aliqua sed incididunt lorem ut elit aliqua lorem elit sed aliqua tempor consectetur consectetur adipiscing consectetur sed adipiscing et incididunt magna ut dolor consectetur lorem dolore ut ut magna tempor dolore sit dolor dolore incididunt magna sed ipsum adipiscing do lorem eiusmod elit et aliqua dolore labore elit aliqua amet do magna eiusmod et elit et elit labore magna et consectetur et ut dolore aliqua lorem ipsum labore magna incididunt aliqua dolor amet lorem consectetur magna tempor dolore labore elit dolor incididunt magna do tempor amet tempor adipiscing incididunt consectetur ipsum consectetur sed adipiscing labore tempor consectetur eiusmod sit sit tempor eiusmod do ut do sit ut magna ut amet lorem amet amet ipsum labore adipiscing lorem et consectetur ipsum do tempor dolore eiusmod ut magna lorem do magna ut adipiscing ut amet consectetur consectetur eiusmod ipsum ipsum adipiscing aliqua lorem lorem magna lorem sed eiusmod ipsum do lorem aliqua ipsum ipsum dolore labore eiusmod dolor adipiscing elit et sed adipiscing adipiscing adipiscing magna amet magna eiusmod aliqua dolor dolor labore do aliqua elit dolore amet eiusmod tempor amet aliqua tempor consectetur tempor do labore ut tempor ipsum elit sit consectetur elit sed incididunt dolore et sit amet sit dolor tempor sed elit et eiusmod ipsum et et incididunt dolore aliqua et eiusmod do et elit aliqua consectetur aliqua adipiscing dolor adipiscing amet eiusmod adipiscing labore sit dolor tempor amet dolore eiusmod consectetur et magna tempor incididunt lorem eiusmod ipsum sed lorem consectetur dolor ipsum et aliqua tempor tempor dolore sit labore dolore adipiscing dolore labore tempor et et dolore aliqua tempor aliqua sit consectetur elit eiusmod ut incididunt incididunt labore tempor sed amet amet et dolor lorem do dolor amet et tempor adipiscing sit tempor sit dolor elit magna magna sed labore dolore eiusmod elit labore elit consectetur incididunt magna consectetur do ipsum magna lorem eiusmod tempor sit ut ipsum dolore lorem et dolore ipsum aliqua lorem dolore adipiscing sed aliqua ipsum dolore elit et adipiscing ut ipsum sed ut tempor et dolore consectetur sit eiusmod dolor et do tempor do eiusmod amet sit dolore incididunt sit sed ut dolor sed sit labore elit "
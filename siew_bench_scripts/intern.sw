@@ -0,0 +1,27 @@
+// Interning: the same few short keys again and again, as literals and built by concatenation.
+// Every compile interns the literals, the concatenations are compared with them (and interned under INTERN_EAGER).
+("owner" == "country") == ("country" == "updated_at") == ("n" + "ame" == "name") == ("co" + "untry" == "country")
+    == ("crea" + "ted_at" == "created_at") == ("em" + "ail" == "email") == ("currency" == "name") == ("i" + "d" == "id")
+    == ("name" == "email") == ("email" == "currency") == ("created_at" == "currency") == ("created_at" == "status")
+    == ("country" == "name") == ("updat" + "ed_at" == "updated_at") == ("balance" == "owner") == ("name" == "owner")
+    == ("created_at" == "name") == ("owne" + "r" == "owner") == ("upd" + "ated_at" == "updated_at") == ("name" == "country")
+    == ("up" + "dated_at" == "updated_at") == ("country" == "name") == ("currency" == "name") == ("upd" + "ated_at" == "updated_at")
+    == ("countr" + "y" == "country") == ("curren" + "cy" == "currency") == ("emai" + "l" == "email") == ("balanc" + "e" == "balance")
+    == ("currenc" + "y" == "currency") == ("name" == "created_at") == ("o" + "wner" == "owner") == ("e" + "mail" == "email")
+    == ("coun" + "try" == "country") == ("owner" == "country") == ("balan" + "ce" == "balance") == ("c" + "reated_at" == "created_at")
+    == ("name" == "name") == ("id" == "email") == ("currency" == "id") == ("b" + "alance" == "balance")
+    == ("updated_at" == "status") == ("balance" == "email") == ("status" == "email") == ("balance" == "owner")
+    == ("status" == "email") == ("i" + "d" == "id") == ("ba" + "lance" == "balance") == ("owner" == "currency")
+    == ("owne" + "r" == "owner") == ("status" == "updated_at") == ("currency" == "id") == ("updated_at" == "currency")
+    == ("name" == "country") == ("owner" == "country") == ("crea" + "ted_at" == "created_at") == ("status" == "balance")
+    == ("emai" + "l" == "email") == ("n" + "ame" == "name") == ("email" == "name") == ("balance" == "created_at")
+    == ("statu" + "s" == "status") == ("currency" == "id") == ("updated_at" == "id") == ("crea" + "ted_at" == "created_at")
+    == ("email" == "id") == ("ema" + "il" == "email") == ("balance" == "balance") == ("id" == "balance")
+    == ("name" == "id") == ("currenc" + "y" == "currency") == ("updated" + "_at" == "updated_at") == ("em" + "ail" == "email")
+    == ("email" == "owner") == ("up" + "dated_at" == "updated_at") == ("i" + "d" == "id") == ("status" == "status")
+    == ("created_at" == "email") == ("i" + "d" == "id") == ("balance" == "id") == ("country" == "status")
+    == ("curr" + "ency" == "currency") == ("name" == "created_at") == ("updated_a" + "t" == "updated_at") == ("email" == "owner")
+    == ("id" == "created_at") == ("c" + "ountry" == "country") == ("created_at" == "owner") == ("status" == "name")
+    == ("emai" + "l" == "email") == ("i" + "d" == "id") == ("bala" + "nce" == "balance") == ("owner" == "country")
+    == ("co" + "untry" == "country") == ("na" + "me" == "name") == ("owner" == "updated_at") == ("em" + "ail" == "email")
+    == ("i" + "d" == "id")
@@ -6,7 +6,10 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "siew/memory.h"
 #include "siew/object.h"
+#include "siew/number.h"
 
 #ifdef DEBUG_PRINT_CODE
 #include "siew/debug.h"
@@ -17,6 +20,8 @@ typedef struct {
     Token previous;
     bool hadError;
     bool panicMode;
+    TokenBuffer tokens; // tokens scanned ahead of current
+    int next; // index in tokens of the token after current
 } Parser;
 
 typedef enum {
@@ -44,10 +49,223 @@ typedef struct {
 Parser parser;
 Chunk* compilingChunk;
 
+// how deep the stack is at the point of the code we are emitting, to know the chunk's maxStack
+static int stackDepth;
+static int pendingOperands; // operand bytes still to come for the last opcode, those don't touch the stack
+
 static Chunk* currentChunk() {
     return compilingChunk;
 }
 
+static void error(const char* message);
+
+// The register backend (chunk->backend == BACKEND_REGISTER).
+// The parser doesn't know about it: it still emits the stack VM's opcodes, in the same order. Here, instead of
+// writing the pushes, we keep a stack of operands at compile time, and every operator becomes one instruction
+// that names its operands. What is in the slot p of the stack VM's stack goes to register p, so there are never
+// more registers than the stack code's maxStack, and a result never overwrites something still in use.
+// Literals are not pushed at all, they are constants (each distinct one once) and read from where they are.
+//
+// An operand is a register, or a constant tagged with CONSTANT_OPERAND. Registers come after the constants in
+// the frame, so their real index is only known at the end: endRegisterCode() rewrites every operand then.
+#define FRAME_HALF 0x8000 // constants and registers get up to this many slots each, all of them fit in 16 bits
+#define CONSTANT_OPERAND 0x8000
+
+typedef struct {
+    int* operands; // what the stack VM would have on its stack, as operands
+    int count;
+    int capacity;
+    int registers; // registers used so far
+    int* constantSlots; // open addressing over the chunk's constants, index + 1 (0 is empty)
+    int constantCapacity;
+} RegisterEmitter;
+
+static RegisterEmitter registerEmitter;
+
+static bool emittingRegisters() {
+    return currentChunk()->backend == BACKEND_REGISTER;
+}
+
+static void freeRegisterEmitter() {
+    FREE_ARRAY(int, registerEmitter.operands, registerEmitter.capacity);
+    FREE_ARRAY(int, registerEmitter.constantSlots, registerEmitter.constantCapacity);
+    registerEmitter = (RegisterEmitter){0};
+}
+
+// literals only: no NaN, and no -0 (there is no negative literal), so the bits are the number
+static uint32_t hashLiteral(Value value) {
+    uint64_t bits = 0;
+    switch (value.type) {
+        case VAL_BOOL: bits = AS_BOOL(value) ? 1 : 2; break;
+        case VAL_NIL: bits = 3; break;
+        case VAL_NUMBER: memcpy(&bits, &value.as.number, sizeof(bits)); break;
+        case VAL_INT: bits = (uint64_t)(uint32_t)AS_INT(value); break;
+        case VAL_OBJ: bits = (uint64_t)(uintptr_t)AS_OBJ(value); break; // strings from literals are interned
+    }
+    bits ^= bits >> 29;
+    return (uint32_t)((bits * 0x9E3779B97F4A7C15ull) >> 32) ^ (uint32_t)value.type;
+}
+
+static bool sameLiteral(Value a, Value b) {
+    if (a.type != b.type) return false;
+    switch (a.type) {
+        case VAL_BOOL: return AS_BOOL(a) == AS_BOOL(b);
+        case VAL_NIL: return true;
+        case VAL_NUMBER: return memcmp(&a.as.number, &b.as.number, sizeof(double)) == 0;
+        case VAL_INT: return AS_INT(a) == AS_INT(b);
+        case VAL_OBJ: return AS_OBJ(a) == AS_OBJ(b);
+    }
+    return false;
+}
+
+// where the literal's constant is (added if it's new), -1 when there is no room for another one
+static int literalConstant(Value value) {
+    Chunk* chunk = currentChunk();
+    RegisterEmitter* emitter = &registerEmitter;
+    if ((chunk->constants.count + 1) * 2 > emitter->constantCapacity) {
+        int oldCapacity = emitter->constantCapacity;
+        emitter->constantCapacity = oldCapacity < 64 ? 64 : oldCapacity * 2;
+        ENTER_ALLOCATION_SITE("register emitter");
+        emitter->constantSlots = GROW_ARRAY(int, emitter->constantSlots, oldCapacity, emitter->constantCapacity);
+        LEAVE_ALLOCATION_SITE();
+        memset(emitter->constantSlots, 0, sizeof(int) * emitter->constantCapacity);
+        for (int i = 0; i < chunk->constants.count; i++) {
+            uint32_t slot = hashLiteral(chunk->constants.values[i]) & (emitter->constantCapacity - 1);
+            while (emitter->constantSlots[slot] != 0) slot = (slot + 1) & (emitter->constantCapacity - 1);
+            emitter->constantSlots[slot] = i + 1;
+        }
+    }
+
+    uint32_t slot = hashLiteral(value) & (emitter->constantCapacity - 1);
+    for (;;) {
+        int index = emitter->constantSlots[slot] - 1;
+        if (index < 0) break;
+        if (sameLiteral(chunk->constants.values[index], value)) return index;
+        slot = (slot + 1) & (emitter->constantCapacity - 1);
+    }
+
+    if (chunk->constants.count >= FRAME_HALF) return -1;
+    int index = addConstant(chunk, value);
+    emitter->constantSlots[slot] = index + 1;
+    return index;
+}
+
+static void pushOperand(int operand) {
+    RegisterEmitter* emitter = &registerEmitter;
+    if (emitter->count == emitter->capacity) {
+        int oldCapacity = emitter->capacity;
+        emitter->capacity = GROW_CAPACITY(oldCapacity);
+        ENTER_ALLOCATION_SITE("register emitter");
+        emitter->operands = GROW_ARRAY(int, emitter->operands, oldCapacity, emitter->capacity);
+        LEAVE_ALLOCATION_SITE();
+    }
+    emitter->operands[emitter->count++] = operand;
+}
+
+static void emitRegisterOperand(int operand) {
+    uint8_t bytes[2];
+    writeRegisterOperand(bytes, operand);
+    writeChunk(currentChunk(), bytes[0], parser.previous.line);
+    writeChunk(currentChunk(), bytes[1], parser.previous.line);
+}
+
+// the register the result of something with its first input at position p of the stack goes to
+static int resultRegister(int position) {
+    if (position >= FRAME_HALF) {
+        error("Expression too deep for the register backend.");
+        return 0;
+    }
+    if (position + 1 > registerEmitter.registers) registerEmitter.registers = position + 1;
+    return position;
+}
+
+static void registerLiteral(Value value) {
+    // a string literal is only ours until it is in the constants, and the slots can grow (and collect) before that
+    push(value);
+    int constant = literalConstant(value);
+    pop();
+    if (constant >= 0) {
+        pushOperand(constant | CONSTANT_OPERAND);
+        return;
+    }
+    // the constants are full: numbers can still go in the code, into a register (as a double, it prints the same)
+    if (!IS_NUMBER(value)) {
+        error("Too many constants in one chunk.");
+        return;
+    }
+    int dst = resultRegister(registerEmitter.count);
+    uint8_t bytes[sizeof(double)];
+    double number = AS_NUMBER(value);
+    memcpy(bytes, &number, sizeof(double));
+    writeChunk(currentChunk(), R_NUMBER, parser.previous.line);
+    emitRegisterOperand(dst);
+    for (size_t i = 0; i < sizeof(double); i++) writeChunk(currentChunk(), bytes[i], parser.previous.line);
+    pushOperand(dst);
+}
+
+static uint8_t registerOpcodeFor(uint8_t stackOp) {
+#define REGISTER_FOR_STACK(name, form, stackOp) case stackOp: return name;
+    switch (stackOp) {
+        FOR_EACH_REGISTER_OPCODE(REGISTER_FOR_STACK)
+        default: return REGISTER_OP_COUNT;
+    }
+#undef REGISTER_FOR_STACK
+}
+
+// a stack opcode from the parser, see RegisterEmitter
+static void registerInstruction(uint8_t stackOp) {
+    switch (stackOp) {
+        case OP_NIL: registerLiteral(NIL_VAL); return;
+        case OP_TRUE: registerLiteral(BOOL_VAL(true)); return;
+        case OP_FALSE: registerLiteral(BOOL_VAL(false)); return;
+        default: break;
+    }
+
+    uint8_t instruction = registerOpcodeFor(stackOp);
+    RegisterForm form = registerOpForm(instruction);
+    int inputs = form == REGISTER_BINARY ? 2 : 1;
+    // after a syntax error the parser goes on without pushing what it couldn't parse, nothing of this will run
+    if (instruction == REGISTER_OP_COUNT || registerEmitter.count < inputs) return;
+
+    registerEmitter.count -= inputs;
+    int* sources = &registerEmitter.operands[registerEmitter.count];
+    writeChunk(currentChunk(), instruction, parser.previous.line);
+    if (form == REGISTER_RETURN) {
+        emitRegisterOperand(sources[0]);
+        return;
+    }
+
+    int dst = resultRegister(registerEmitter.count);
+    emitRegisterOperand(dst);
+    for (int i = 0; i < inputs; i++) emitRegisterOperand(sources[i]);
+    pushOperand(dst);
+}
+
+// Now we know how many constants there are: registers go after them, and every operand gets its frame slot
+static void endRegisterCode() {
+    Chunk* chunk = currentChunk();
+    int constants = chunk->constants.count;
+    if (!parser.hadError) {
+        for (int offset = 0; offset < chunk->count; offset += 1 + registerOperandCount(chunk->code[offset])) {
+            uint8_t* operand = &chunk->code[offset + 1];
+            int operands = 0;
+            switch (registerOpForm(chunk->code[offset])) {
+                case REGISTER_BINARY: operands = 3; break;
+                case REGISTER_UNARY: operands = 2; break;
+                case REGISTER_LOAD_NUMBER: operands = 1; break;
+                case REGISTER_RETURN: operands = 1; break;
+            }
+            for (int i = 0; i < operands; i++, operand += 2) {
+                int value = readRegisterOperand(operand);
+                value = (value & CONSTANT_OPERAND) ? value & ~CONSTANT_OPERAND : constants + value;
+                writeRegisterOperand(operand, value);
+            }
+        }
+    }
+    chunk->maxStack = constants + registerEmitter.registers;
+    freeRegisterEmitter();
+}
+
 static void errorAt(Token* token, const char* message) {
     if (parser.panicMode) return;
     parser.panicMode = true;
@@ -82,7 +300,14 @@ static void advance() {
     // we loop because the complier or in this case parser is the one in charge of reporting errors
     // since we should only give the parser correct tokens, we loop to report all the errors and return the valid ones
     for (;;) {
-        parser.current = scanToken();
+        // we only go back to the scanner when the whole batch is consumed
+        if (parser.next == parser.tokens.count) {
+            // previous is passed so its lexeme survives if the scanner slides its window
+            scanTokens(&parser.tokens, &parser.previous);
+            parser.next = 0;
+        }
+
+        parser.current = tokenAt(&parser.tokens, parser.next++);
         if (parser.current.type != TOKEN_ERROR) break;
 
         errorAtCurrent(parser.current.start);
@@ -99,7 +324,22 @@ static void consume(TokenType type, const char* message) {
 }
 
 static void emitByte(uint8_t byte) {
-    writeChunk(currentChunk(), byte, parser.previous.line);
+    Chunk* chunk = currentChunk();
+    // in register code only opcodes come here, operands have their own path (see registerLiteral())
+    if (chunk->backend == BACKEND_REGISTER) {
+        registerInstruction(byte);
+        return;
+    }
+
+    if (pendingOperands > 0) {
+        pendingOperands--;
+    } else {
+        stackDepth += opStackEffect(byte);
+        if (stackDepth > chunk->maxStack) chunk->maxStack = stackDepth;
+        pendingOperands = opOperandCount(byte);
+    }
+
+    writeChunk(chunk, byte, parser.previous.line);
 }
 
 static void emitBytes(uint8_t byte1, uint8_t byte2) {
@@ -116,7 +356,7 @@ static uint8_t makeConstant(Value value) {
 
     if (constant > UINT8_MAX) {
         // the current implementation has a limitation of only 256 constant
-        // this is too small, to change it, we need to apply the TODOs that we have in the chunk.h file
+        // this is too small, to change it, we need to apply the TODOs that we have in include/siew/opcodes.h
         error("Too many constants in one chuck.");
         return 0;
     }
@@ -125,11 +365,16 @@ static uint8_t makeConstant(Value value) {
 }
 
 static void emitConstant(Value constant) {
+    if (emittingRegisters()) {
+        registerLiteral(constant);
+        return;
+    }
     emitBytes(OP_CONSTANT, makeConstant(constant));
 }
 
 static void endCompiler() {
     emitReturn();
+    if (emittingRegisters()) endRegisterCode();
 
 #ifdef DEBUG_PRINT_CODE
     if (!parser.hadError) {
@@ -200,15 +445,40 @@ static void expression() {
 static void number() {
     // we are making an assumption here, we assume that the token for the number literal
     // is already consumed, so we use the previous token (the number)
-    double value = strtod(parser.previous.start, NULL);
-    emitConstant(NUMBER_VAL(value));
+    double value = parseNumber(parser.previous.start, parser.previous.length);
+    // a literal is never negative, so no -0 here: a whole number in range is an int (see INT_VAL)
+    bool integer = value <= INT32_MAX && value == (double)(int32_t)value;
+    if (emittingRegisters()) {
+        registerLiteral(integer ? INT_VAL((int32_t)value) : NUMBER_VAL(value));
+        return;
+    }
+
+    // numbers never take a constant slot, their value goes in the code
+    if (integer && value <= INT8_MAX) {
+        emitBytes(OP_SMALL_INT, (uint8_t)(int8_t)value);
+        return;
+    }
+    if (integer) {
+        uint8_t bytes[sizeof(int32_t)];
+        int32_t small = (int32_t)value;
+        memcpy(bytes, &small, sizeof(int32_t));
+        emitByte(OP_INT);
+        for (size_t i = 0; i < sizeof(int32_t); i++) emitByte(bytes[i]);
+        return;
+    }
+
+    uint8_t bytes[sizeof(double)];
+    memcpy(bytes, &value, sizeof(double));
+    emitByte(OP_NUMBER);
+    for (size_t i = 0; i < sizeof(double); i++) emitByte(bytes[i]);
 }
 
 static void string() {
     // we add 1 to start after the '"' and we subtract 2 to the length to not count the '"' as well
 
     // if we want to add things like \n to the SIEW strings, we should handle those scenarios here.
-    emitConstant(OBJ_VAL(copyString(parser.previous.start + 1, parser.previous.length - 2)));
+    // the scanner already hashed the contents for us
+    emitConstant(OBJ_VAL(copyStringHashed(parser.previous.start + 1, parser.previous.length - 2, parser.previous.hash)));
 }
 
 static void grouping() {
@@ -307,17 +577,57 @@ static ParseRule* getRule(TokenType type) {
     return &rules[type];
 }
 
-bool compile(const char* source, Chunk* chunk) {
-    initScanner(source);
-
+static bool compileScanned(Chunk* chunk) {
     compilingChunk = chunk;
+    stackDepth = 0;
+    pendingOperands = 0;
     parser.hadError = false;
     parser.panicMode = false;
+    parser.tokens.count = 0;
+    parser.next = 0;
+    parser.previous.line = 0; // until the first token, we are at no line
 
     advance();
     expression();
     consume(TOKEN_EOF, "Expect end of expression.");
 
     endCompiler();
+    compilingChunk = NULL;
+    // what we emit is valid by construction (and maxStack is exact), there is nothing for the verifier to find
+    chunk->verified = !parser.hadError;
     return !parser.hadError;
+}
+
+bool compile(const char* source, Chunk* chunk) {
+    initScanner(source);
+    return compileScanned(chunk);
+}
+
+// Same as compile(), but the source is read from file a window at a time, so it never has to be in memory at once.
+bool compileFile(FILE* file, Chunk* chunk) {
+    initScannerFile(file);
+    bool compiled = compileScanned(chunk);
+    freeScannerFile();
+    return compiled;
+}
+
+// We were thrown out of compile() (out of memory), the chunk we were filling is gone.
+void abortCompilation() {
+    compilingChunk = NULL;
+    freeRegisterEmitter();
+    freeScannerFile();
+}
+
+int compilingLine() {
+    if (compilingChunk == NULL) return 0;
+    return parser.previous.line;
+}
+
+// while we compile, the constants we already created are only referenced by the chunk we are filling
+void markCompilerRoots() {
+    if (compilingChunk == NULL) return;
+
+    for (int i = 0; i < compilingChunk->constants.count; i++) {
+        markValue(compilingChunk->constants.values[i]);
+    }
 }
\ No newline at end of file
@@ -4,24 +4,186 @@
 
 #include <stdbool.h>
 #include "siew/scanner.h"
+#include "siew/object.h"
 
 #include <ctype.h>
+#include <stdio.h>
 #include <string.h>
 
+#include "siew/memory.h"
+
+// With SSE2 (every x86-64 has it) or AVX2 we can look at 16 or 32 chars at once instead of one by one.
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__AVX2__))
+#define SCANNER_SIMD
+#include <immintrin.h>
+#endif
+
+#define WINDOW_SIZE (64 * 1024)
+// a batch only starts if at least this much source is left in the window, otherwise we refill first
+#define WINDOW_LOW_WATER (WINDOW_SIZE / 4)
+
 typedef struct {
+    const char* source;
     const char* start;
     const char* current;
+    const char* end; // the '\0' at the end of the source. The vector loops never read past it
     int line;
+    bool vectorized;
+
+    // Streaming: instead of the whole source we only hold a window of it, refilled from file as we go.
+    // When file is NULL, source is the entire program and none of this is used.
+    FILE* file;
+    char* window;
+    size_t windowCapacity;
+    bool fileDone;  // everything left in the file is already in the window
+    bool needMore;  // the last batch stopped at a token that touched the end of the window
 } Scanner;
 
 Scanner scanner; // again... we should pass this in the functions as a pointer and should not be global
 
+// the scalar scanner is the reference, we keep it around to compare against
+static bool useVectorized = true;
+
+void setScannerVectorized(bool enabled) {
+    useVectorized = enabled;
+}
+
+#ifdef SCANNER_SIMD
+// Same few operations for both widths, so the fast paths below are written only once.
+#ifdef __AVX2__
+typedef __m256i Block;
+#define BLOCK_SIZE 32
+#define BLOCK_FULL_MASK 0xFFFFFFFFu
+#define BLOCK_LOAD(p)      _mm256_loadu_si256((const __m256i*)(p))
+#define BLOCK_SPLAT(c)     _mm256_set1_epi8(c)
+#define BLOCK_EQ(a, b)     _mm256_cmpeq_epi8(a, b)
+#define BLOCK_OR(a, b)     _mm256_or_si256(a, b)
+#define BLOCK_SUB(a, b)    _mm256_sub_epi8(a, b)
+#define BLOCK_MIN(a, b)    _mm256_min_epu8(a, b)
+#define BLOCK_MASK(block)  ((uint32_t)_mm256_movemask_epi8(block))
+#else
+typedef __m128i Block;
+#define BLOCK_SIZE 16
+#define BLOCK_FULL_MASK 0xFFFFu
+#define BLOCK_LOAD(p)      _mm_loadu_si128((const __m128i*)(p))
+#define BLOCK_SPLAT(c)     _mm_set1_epi8(c)
+#define BLOCK_EQ(a, b)     _mm_cmpeq_epi8(a, b)
+#define BLOCK_OR(a, b)     _mm_or_si128(a, b)
+#define BLOCK_SUB(a, b)    _mm_sub_epi8(a, b)
+#define BLOCK_MIN(a, b)    _mm_min_epu8(a, b)
+#define BLOCK_MASK(block)  ((uint32_t)_mm_movemask_epi8(block))
+#endif
+
+// one bit per char of the block, set if the char is in [low, low + count)
+static inline uint32_t rangeMask(Block block, char low, int count) {
+    // the unsigned trick: c - low wraps around for chars under low, so a single "<= count - 1" check does both ends
+    Block offset = BLOCK_SUB(block, BLOCK_SPLAT(low));
+    return BLOCK_MASK(BLOCK_EQ(BLOCK_MIN(offset, BLOCK_SPLAT((char)(count - 1))), offset));
+}
+
+static inline uint32_t digitMask(Block block) {
+    return rangeMask(block, '0', 10);
+}
+#endif
+
+// All the fast paths below work the same way: they jump ahead while a whole block matches and stop at the
+// block that contains the interesting char (or when less than a block is left). They never consume that char,
+// the original scalar loops right after them finish the job. Without SIMD they don't move at all.
+//
+// Most runs are short (a single space, a 3 digits number), and for those loading and classifying a whole block
+// costs more than the few scalar steps. So we only go for blocks when the char SHORT_RUN positions ahead still
+// belongs to the run. It is just a guess (the run could stop and start again in between), a wrong guess only
+// costs a block load, the masks always find the real end.
+#define SHORT_RUN 8
+
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static inline bool isDigitAhead(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// spaces, tabs, \r and \n. We have to count the new lines we jump over.
+static inline void fastSkipBlanks() {
+#ifdef SCANNER_SIMD
+    const char* p = scanner.current;
+    // the common case by far is a single space between two tokens, that one we want out of here fast
+    if (!isBlank(p[0])) return;
+    if (!scanner.vectorized || scanner.end - p < BLOCK_SIZE || !isBlank(p[SHORT_RUN])) return;
+
+    while (scanner.end - p >= BLOCK_SIZE) {
+        Block block = BLOCK_LOAD(p);
+        uint32_t newlines = BLOCK_MASK(BLOCK_EQ(block, BLOCK_SPLAT('\n')));
+        uint32_t blanks = newlines |
+            BLOCK_MASK(BLOCK_OR(BLOCK_OR(BLOCK_EQ(block, BLOCK_SPLAT(' ')), BLOCK_EQ(block, BLOCK_SPLAT('\t'))),
+                                BLOCK_EQ(block, BLOCK_SPLAT('\r'))));
+        uint32_t stop = ~blanks & BLOCK_FULL_MASK;
+        if (stop != 0) {
+            int index = __builtin_ctz(stop);
+            scanner.line += __builtin_popcount(newlines & ((1u << index) - 1));
+            p += index;
+            break;
+        }
+        scanner.line += __builtin_popcount(newlines);
+        p += BLOCK_SIZE;
+    }
+    scanner.current = p;
+#endif
+}
+
+// Moves to the next `target` char. Only the string scan needs new lines counted (countLines), a comment
+// stops right at its '\n' and lets skipWhitespaceAndComments count it.
+static inline void fastFindChar(char target, bool countLines) {
+#ifdef SCANNER_SIMD
+    if (!scanner.vectorized) return;
+    const char* p = scanner.current;
+    while (scanner.end - p >= BLOCK_SIZE) {
+        Block block = BLOCK_LOAD(p);
+        uint32_t found = BLOCK_MASK(BLOCK_EQ(block, BLOCK_SPLAT(target)));
+        uint32_t newlines = countLines ? BLOCK_MASK(BLOCK_EQ(block, BLOCK_SPLAT('\n'))) : 0;
+        if (found != 0) {
+            int index = __builtin_ctz(found);
+            scanner.line += __builtin_popcount(newlines & ((1u << index) - 1));
+            p += index;
+            break;
+        }
+        scanner.line += __builtin_popcount(newlines);
+        p += BLOCK_SIZE;
+    }
+    scanner.current = p;
+#endif
+}
+
+// Skips [0-9]. There is no such path for identifiers: even with the gate, names (and the 20 something chars
+// ones of the generated scripts) end too soon for a block scan to beat the scalar loop, it only lost time there.
+// Long numbers do win, from about 12 digits.
+static inline void fastSkipDigits() {
+#ifdef SCANNER_SIMD
+    const char* p = scanner.current;
+    if (!scanner.vectorized || scanner.end - p < BLOCK_SIZE ||
+        !isDigitAhead(p[SHORT_RUN / 2]) || !isDigitAhead(p[SHORT_RUN])) return;
+
+    while (scanner.end - p >= BLOCK_SIZE) {
+        Block block = BLOCK_LOAD(p);
+        uint32_t stop = ~digitMask(block) & BLOCK_FULL_MASK;
+        if (stop != 0) {
+            p += __builtin_ctz(stop);
+            break;
+        }
+        p += BLOCK_SIZE;
+    }
+    scanner.current = p;
+#endif
+}
+
 static Token errorToken(const char* message) {
     Token token;
     token.type = TOKEN_ERROR;
     token.start = message;
     token.length = (int)strlen(message);
     token.line = scanner.line;
+    token.hash = 0;
     return token;
 }
 
@@ -31,15 +193,88 @@ static Token makeToken(TokenType type) {
     token.start = scanner.start;
     token.length = (int)(scanner.current - scanner.start);
     token.line = scanner.line;
+    token.hash = 0;
     return token;
 }
 
 void initScanner(const char* source) {
     // just if we forget, this is a pointer to the start of the char string, not exactly
     // the entire string
+    scanner.source = source;
     scanner.start = source;
     scanner.current = source;
+    scanner.end = source + strlen(source);
     scanner.line = 1;
+    scanner.vectorized = useVectorized;
+    scanner.file = NULL;
+    scanner.window = NULL;
+    scanner.windowCapacity = 0;
+    scanner.fileDone = true;
+    scanner.needMore = false;
+}
+
+// We can't assume the file fits in memory (or that it can even be measured, like a pipe), and Token.start
+// used to assume the whole source lives during the whole compilation. Now the scanner reads a window,
+// and slides it forward as the parser consumes tokens. The only lexemes that must survive the slide are
+// the ones the parser still holds, and those are kept by moving them to the front of the window.
+void initScannerFile(FILE* file) {
+    scanner.windowCapacity = WINDOW_SIZE;
+    ENTER_ALLOCATION_SITE("scanner window");
+    scanner.window = (char*)reallocate(NULL, 0, scanner.windowCapacity);
+    LEAVE_ALLOCATION_SITE();
+    scanner.window[0] = '\0';
+
+    scanner.source = scanner.window;
+    scanner.start = scanner.window;
+    scanner.current = scanner.window;
+    scanner.end = scanner.window;
+    scanner.line = 1;
+    scanner.vectorized = useVectorized;
+    scanner.file = file;
+    scanner.fileDone = false;
+    scanner.needMore = false;
+}
+
+void freeScannerFile() {
+    if (scanner.window == NULL) return;
+    reallocate(scanner.window, scanner.windowCapacity, 0);
+    scanner.window = NULL;
+    scanner.file = NULL;
+}
+
+// Moves everything from keepFrom on to the front of the window and fills the rest from the file.
+// If the kept part is so big that there is no room to read much (a giant string or comment), the window grows.
+// Returns how much every pointer into the old window has to move to point to the same char now.
+static ptrdiff_t refillWindow(const char* keepFrom) {
+    size_t keep = (size_t)(scanner.end - keepFrom);
+    ptrdiff_t keepOffset = keepFrom - scanner.window;
+    memmove(scanner.window, keepFrom, keep);
+
+    char* oldWindow = scanner.window;
+    if (scanner.windowCapacity - 1 - keep < scanner.windowCapacity / 2) {
+        size_t oldCapacity = scanner.windowCapacity;
+        scanner.windowCapacity *= 2;
+        ENTER_ALLOCATION_SITE("scanner window");
+        scanner.window = (char*)reallocate(scanner.window, oldCapacity, scanner.windowCapacity);
+        LEAVE_ALLOCATION_SITE();
+    }
+
+    size_t read = fread(scanner.window + keep, 1, scanner.windowCapacity - 1 - keep, scanner.file);
+    if (read == 0) scanner.fileDone = true;
+    scanner.window[keep + read] = '\0';
+
+    // the same char, now at (window + position - keepOffset)
+    ptrdiff_t delta = (scanner.window - oldWindow) - keepOffset;
+    scanner.source = scanner.window;
+    scanner.start += delta;
+    scanner.current += delta;
+    scanner.end = scanner.window + keep + read;
+    return delta;
+}
+
+static bool inWindow(const char* pointer) {
+    uintptr_t address = (uintptr_t)pointer;
+    return address >= (uintptr_t)scanner.window && address <= (uintptr_t)scanner.end;
 }
 
 static bool isAtEnd() {
@@ -81,14 +316,17 @@ static void skipWhitespaceAndComments() {
             case '\r':
             case '\t':
                 advance();
+                fastSkipBlanks();
                 break;
             case '\n':
                 scanner.line++;
                 advance();
+                fastSkipBlanks();
                 break;
             case '/':
                 if (peekNext() == '/') {
                     // A comment goes until the end of the line.
+                    fastFindChar('\n', false);
                     while (peek() != '\n' && !isAtEnd()) advance();
                 } else {
                     return;
@@ -101,6 +339,7 @@ static void skipWhitespaceAndComments() {
 }
 
 static Token string() {
+    fastFindChar('"', true);
     while (peek() != '"' && !isAtEnd()) {
         if (peek() == '\n') scanner.line++;
         advance();
@@ -115,7 +354,10 @@ static Token string() {
 
     // the value is going to be the lexeme that is created here when the token is created
     // clever!!
-    return makeToken(TOKEN_STRING);
+    Token token = makeToken(TOKEN_STRING);
+    // the compiler interns the contents (without the quotes) with this hash, so it doesn't hash them again
+    token.hash = hashString(token.start + 1, token.length - 2);
+    return token;
 }
 
 static bool isDigit(char c) {
@@ -123,12 +365,14 @@ static bool isDigit(char c) {
 }
 
 static Token number() {
-   while (isDigit(peek())) advance();
+    fastSkipDigits();
+    while (isDigit(peek())) advance();
 
     if (peek() == '.' && isdigit(peekNext())) {
         // we need to consume the dot '.'
         advance();
 
+        fastSkipDigits();
         while (isDigit(peek())) advance();
     }
 
@@ -140,50 +384,64 @@ static bool isAlpha(char c){
     return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
 }
 
-static TokenType checkKeyword(int start, int length, const char* rest, TokenType type){
-   if (scanner.current - scanner.start == start + length &&
-       memcmp(scanner.start + start, rest, length) == 0) {
-      return type;
-  }
+typedef struct {
+    const char* name;
+    int length;
+    TokenType type;
+} Keyword;
 
-  return TOKEN_IDENTIFIER;
+// A minimal perfect hash for our 16 keywords: every keyword lands in its own slot of a 16 slots table.
+// With it, recognizing a keyword is: one hash, one length check and one memcmp. No trie.
+//
+// The table is generated, there is nothing random in it. If a keyword is ever added or removed, run the search
+// again (a few lines of anything, it takes no time):
+//
+//     for a in 1..63, for b in 1..63, for c in 1..15 (in that order):
+//         hash = start[0] * a + start[1] * b + length * c     (unsigned 32 bits, chars as unsigned)
+//         slot = (hash ^ (hash >> 4)) & 15
+//         stop at the first (a, b, c) that gives the 16 keywords 16 different slots
+//
+// For our keywords that is (38, 48, 6) (the only other one in those ranges is (46, 55, 7)).
+// Then put every keyword at its slot below. More keywords than slots means a bigger table (and mask) first.
+#define KEYWORD_SLOTS 16
+#define KEYWORD_MIN_LENGTH 2
+#define KEYWORD_MAX_LENGTH 6
+
+static const Keyword keywords[KEYWORD_SLOTS] = {
+    {"return", 6, TOKEN_RETURN}, // 0
+    {"class",  5, TOKEN_CLASS},  // 1
+    {"super",  5, TOKEN_SUPER},  // 2
+    {"else",   4, TOKEN_ELSE},   // 3
+    {"fun",    3, TOKEN_FUN},    // 4
+    {"false",  5, TOKEN_FALSE},  // 5
+    {"for",    3, TOKEN_FOR},    // 6
+    {"nil",    3, TOKEN_NIL},    // 7
+    {"or",     2, TOKEN_OR},     // 8
+    {"and",    3, TOKEN_AND},    // 9
+    {"var",    3, TOKEN_VAR},    // 10
+    {"true",   4, TOKEN_TRUE},   // 11
+    {"while",  5, TOKEN_WHILE},  // 12
+    {"this",   4, TOKEN_THIS},   // 13
+    {"if",     2, TOKEN_IF},     // 14
+    {"print",  5, TOKEN_PRINT},  // 15
+};
+
+static unsigned int keywordSlot(const char* start, int length) {
+    unsigned int hash = (unsigned char)start[0] * 38u + (unsigned char)start[1] * 48u + (unsigned int)length * 6u;
+    return (hash ^ (hash >> 4)) & (KEYWORD_SLOTS - 1);
 }
 
 static TokenType identifierType() {
-   switch (scanner.start[0]) {
-      case 'a': return checkKeyword(1, 2, "nd", TOKEN_AND);
-      case 'c': return checkKeyword(1, 4, "lass", TOKEN_CLASS);
-      case 'e': return checkKeyword(1, 3, "lse", TOKEN_ELSE);
-      case 'f':
-        // we must verify that there are a second letter before continue
-        // since 'f' is still a valid identifier after all
-        if (scanner.current - scanner.start > 1) {
-          switch (scanner.start[1]) {
-              case 'a': return checkKeyword(2, 3, "lse", TOKEN_FALSE);
-              case 'o': return checkKeyword(2, 1, "r", TOKEN_FOR);
-              case 'n': return TOKEN_FUN;
-          }
-        }
-        break;
-      case 'i': return checkKeyword(1, 1, "f", TOKEN_IF);
-      case 'n': return checkKeyword(1, 2, "il", TOKEN_NIL);
-      case 'o': return checkKeyword(1, 1, "r", TOKEN_OR);
-      case 'p': return checkKeyword(1, 4, "rint", TOKEN_PRINT);
-      case 'r': return checkKeyword(1, 5, "eturn", TOKEN_RETURN);
-      case 's': return checkKeyword(1, 4, "uper", TOKEN_SUPER);
-      case 't':
-           // same as f, we verify if there are a second letter before continue
-        if (scanner.current - scanner.start > 1) {
-          switch (scanner.start[1]) {
-              case 'h': return checkKeyword(2, 2, "is", TOKEN_THIS);
-              case 'r': return checkKeyword(2, 2, "ue", TOKEN_TRUE);
-          }
-        }
-      break;
-      case 'v': return checkKeyword(1, 2, "ar", TOKEN_VAR);
-      case 'w': return checkKeyword(1, 4, "hile", TOKEN_WHILE);
-  }
-  return TOKEN_IDENTIFIER;
+    int length = (int)(scanner.current - scanner.start);
+    // no keyword is shorter or longer than this, and we need at least 2 chars to hash
+    if (length < KEYWORD_MIN_LENGTH || length > KEYWORD_MAX_LENGTH) return TOKEN_IDENTIFIER;
+
+    const Keyword* keyword = &keywords[keywordSlot(scanner.start, length)];
+    if (keyword->length == length && memcmp(scanner.start, keyword->name, length) == 0) {
+        return keyword->type;
+    }
+
+    return TOKEN_IDENTIFIER;
 }
 
 static Token identifier() {
@@ -239,3 +497,60 @@ Token scanToken() {
 
     return errorToken("Unexpected character.");
 }
+
+// Scans up to TOKEN_BATCH tokens in one go. The batch ends early at the EOF token, which is always included.
+// When streaming, keep is the token the parser still needs from the previous batch. Its lexeme stays
+// valid (keep->start is updated if the window moves). Every token of the previous batch is gone.
+void scanTokens(TokenBuffer* buffer, Token* keep) {
+    int count = 0;
+    while (count < TOKEN_BATCH) {
+        bool streaming = scanner.file != NULL && !scanner.fileDone;
+        if (streaming && count == 0 && (scanner.needMore || scanner.end - scanner.current < WINDOW_LOW_WATER)) {
+            const char* keepFrom = scanner.current;
+            bool keepToken = keep != NULL && keep->type != TOKEN_ERROR && inWindow(keep->start);
+            if (keepToken && keep->start < keepFrom) keepFrom = keep->start;
+
+            ptrdiff_t delta = refillWindow(keepFrom);
+            if (keepToken) keep->start += delta;
+            scanner.needMore = false;
+            streaming = !scanner.fileDone;
+        }
+
+        const char* before = scanner.current;
+        int lineBefore = scanner.line;
+        Token token = scanToken();
+
+        // A token that reaches the end of the window may continue in the part of the file we haven't read
+        // (half an identifier, a string whose closing quote is not here yet, "!" from a "!="...), even
+        // an EOF is a lie. So we forget it, and scan it again after the refill.
+        if (streaming && scanner.end - scanner.current < 2) {
+            scanner.current = before;
+            scanner.line = lineBefore;
+            scanner.needMore = true;
+            if (count > 0) break;
+            continue;
+        }
+
+        // A source can be bigger than 4 GiB (a mmapped file), so offsets are from the first token of the batch.
+        // The rest of a batch is close to it, unless something huge (a comment...) sits in between. Then the
+        // batch ends before this token and the next one starts from it.
+        if (count == 0) buffer->base = token.type == TOKEN_ERROR ? before : token.start;
+        size_t offset = token.type == TOKEN_ERROR ? 0 : (size_t)(token.start - buffer->base);
+        if (offset > UINT32_MAX) {
+            scanner.current = before;
+            scanner.line = lineBefore;
+            break;
+        }
+
+        buffer->types[count] = (uint8_t)token.type;
+        buffer->lengths[count] = token.length;
+        buffer->lines[count] = token.line;
+        buffer->hashes[count] = token.hash;
+        buffer->offsets[count] = (uint32_t)offset;
+        if (token.type == TOKEN_ERROR) buffer->messages[count] = token.start;
+        count++;
+
+        if (token.type == TOKEN_EOF) break;
+    }
+    buffer->count = count;
+}
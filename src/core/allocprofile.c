@@ -0,0 +1,225 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include "siew/allocprofile.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "siew/chunk.h"
+#include "siew/compiler.h"
+#include "siew/memory.h"
+#include "siew/object.h"
+#include "siew/vm.h"
+
+#define ALLOCATION_SLOTS 4096 // distinct (site, opcode, line) we can keep apart, must be a power of 2
+#define MAX_PROBES 64 // after this many taken slots the allocation goes to the dropped count
+#define TOP_ALLOCATORS 30
+
+// not opcodes, for allocations that don't happen while running bytecode
+#define WHILE_COMPILING -1
+#define OUTSIDE_BYTECODE -2
+
+typedef struct {
+    const char* site; // NULL is an empty slot, allocations without a site are charged to "(other)"
+    int opcode;
+    int line;
+    uint64_t count;
+    uint64_t bytes;
+} AllocationSlot;
+
+// The table can't grow through reallocate(), it would be profiling itself. So it is static, like the sampler's.
+static AllocationSlot slots[ALLOCATION_SLOTS];
+static uint64_t droppedCount;
+static uint64_t droppedBytes;
+static size_t peakBytes;
+
+bool allocationProfiling = false;
+
+void startAllocationProfile() {
+    memset(slots, 0, sizeof(slots));
+    droppedCount = 0;
+    droppedBytes = 0;
+    peakBytes = vm.bytesAllocated;
+    allocationProfiling = true;
+}
+
+void stopAllocationProfile() {
+    allocationProfiling = false;
+}
+
+void recordAllocation(size_t oldSize, size_t newSize) {
+    if (vm.bytesAllocated > peakBytes) peakBytes = vm.bytesAllocated;
+
+    const char* site = allocationSite != NULL ? allocationSite : "(other)";
+    int opcode;
+    int line;
+    // while running, the loops leave ip right after the opcode being executed (every allocation is
+    // preceded by a SPILL() in runCached()). A chunk we are not running has no business here.
+    Chunk* chunk = vm.chunk;
+    if (chunk != NULL && vm.ip > chunk->code && vm.ip <= chunk->code + chunk->count) {
+        int offset = (int)(vm.ip - chunk->code - 1);
+        // register opcodes go after the stack ones, so both can be told apart in the same table
+        opcode = chunk->backend == BACKEND_REGISTER ? OP_COUNT + chunk->code[offset] : chunk->code[offset];
+        line = chunk->lines[offset];
+    } else {
+        line = compilingLine();
+        opcode = line > 0 ? WHILE_COMPILING : OUTSIDE_BYTECODE;
+    }
+
+    uint64_t bytes = newSize - oldSize;
+    // the site names are string literals, the pointer is as good as the name
+    uint32_t hash = ((uint32_t)(uintptr_t)site * 31u + (uint32_t)opcode * 17u + (uint32_t)line) * 2654435761u;
+    for (int probe = 0; probe < MAX_PROBES; probe++) {
+        AllocationSlot* slot = &slots[(hash + (uint32_t)probe) & (ALLOCATION_SLOTS - 1)];
+        if (slot->site == NULL) {
+            slot->site = site;
+            slot->opcode = opcode;
+            slot->line = line;
+        } else if (slot->site != site || slot->opcode != opcode || slot->line != line) {
+            continue;
+        }
+        slot->count++;
+        slot->bytes += bytes;
+        return;
+    }
+    droppedCount++;
+    droppedBytes += bytes;
+}
+
+static int compareBytes(const void* a, const void* b) {
+    uint64_t x = ((const AllocationSlot*)a)->bytes;
+    uint64_t y = ((const AllocationSlot*)b)->bytes;
+    return (x < y) - (x > y);
+}
+
+static double percent(uint64_t part, uint64_t total) {
+    return total == 0 ? 0 : (double)part * 100 / (double)total;
+}
+
+static const char* opcodeColumn(int opcode) {
+    if (opcode == WHILE_COMPILING) return "(compile)";
+    if (opcode == OUTSIDE_BYTECODE) return "(no bytecode)";
+    const char* name = opcode >= OP_COUNT ? registerOpName((uint8_t)(opcode - OP_COUNT)) : opName((uint8_t)opcode);
+    return name != NULL ? name : "?";
+}
+
+static void writeAllocators(FILE* file, AllocationSlot* sorted, int count, uint64_t totalBytes) {
+    fprintf(file, "== top allocators: %d of %d ==\n", count < TOP_ALLOCATORS ? count : TOP_ALLOCATORS, count);
+    fprintf(file, "%-20s %-16s %8s %12s %16s %7s\n", "site", "opcode", "line", "count", "bytes", "%");
+    for (int i = 0; i < count && i < TOP_ALLOCATORS; i++) {
+        fprintf(file, "%-20s %-16s %8d %12llu %16llu %6.2f%%\n", sorted[i].site, opcodeColumn(sorted[i].opcode),
+            sorted[i].line, (unsigned long long)sorted[i].count, (unsigned long long)sorted[i].bytes,
+            percent(sorted[i].bytes, totalBytes));
+    }
+}
+
+// Folds the rows of each site into one. Slots are reused as the accumulator, they are already a copy.
+static void writeSites(FILE* file, AllocationSlot* sorted, int count, uint64_t totalBytes) {
+    int sites = 0;
+    for (int i = 0; i < count; i++) {
+        int j = 0;
+        while (j < sites && sorted[j].site != sorted[i].site) j++;
+        if (j == sites) {
+            sorted[sites].site = sorted[i].site;
+            sorted[sites].count = sorted[i].count;
+            sorted[sites].bytes = sorted[i].bytes;
+            sites++;
+        } else {
+            sorted[j].count += sorted[i].count;
+            sorted[j].bytes += sorted[i].bytes;
+        }
+    }
+    qsort(sorted, (size_t)sites, sizeof(AllocationSlot), compareBytes);
+
+    fprintf(file, "== sites ==\n");
+    for (int i = 0; i < sites; i++) {
+        fprintf(file, "%-20s %12llu allocations %16llu bytes %6.2f%%\n", sorted[i].site,
+            (unsigned long long)sorted[i].count, (unsigned long long)sorted[i].bytes,
+            percent(sorted[i].bytes, totalBytes));
+    }
+}
+
+// What the heap is made of right now: we walk the objects instead of keeping a tally on every free.
+static void writeLiveHeap(FILE* file) {
+    static const char* kindNames[] = {"string (flat)", "string (rope)", "string (slice)"};
+    uint64_t stringCount[3] = {0};
+    uint64_t stringBytes[3] = {0};
+    uint64_t arrayCount = 0;
+    uint64_t arrayBytesTotal = 0;
+
+    for (Obj* object = vm.objects; object != NULL; object = object->next) {
+        switch (object->type) {
+            case OBJ_STRING: {
+                ObjString* string = (ObjString*)object;
+                // same sizes freeObject() gives back: only flat strings own their chars
+                stringCount[string->kind]++;
+                stringBytes[string->kind] += sizeof(ObjString);
+                if (string->kind == STRING_FLAT && string->chars != NULL) stringBytes[string->kind] += (uint64_t)string->length + 1;
+                break;
+            }
+            case OBJ_ARRAY:
+                arrayCount++;
+                arrayBytesTotal += arrayBytes(((ObjArray*)object)->count);
+                break;
+        }
+    }
+
+    uint64_t arenaBytes = 0;
+    for (ArenaBlock* block = vm.compileArena.blocks; block != NULL; block = block->next) {
+        arenaBytes += sizeof(ArenaBlock) + block->capacity;
+    }
+    uint64_t internBytes = (uint64_t)vm.strings.capacity * sizeof(Entry);
+
+    uint64_t total = vm.bytesAllocated;
+    uint64_t accounted = arenaBytes + internBytes;
+    fprintf(file, "== live heap: %llu bytes (peak %llu) ==\n", (unsigned long long)total,
+        (unsigned long long)(peakBytes > total ? peakBytes : total));
+    for (int kind = 0; kind < 3; kind++) {
+        fprintf(file, "%-20s %12llu objects %16llu bytes %6.2f%%\n", kindNames[kind],
+            (unsigned long long)stringCount[kind], (unsigned long long)stringBytes[kind],
+            percent(stringBytes[kind], total));
+        accounted += stringBytes[kind];
+    }
+    fprintf(file, "%-20s %12llu objects %16llu bytes %6.2f%%\n", "array", (unsigned long long)arrayCount,
+        (unsigned long long)arrayBytesTotal, percent(arrayBytesTotal, total));
+    accounted += arrayBytesTotal;
+    fprintf(file, "%-20s %12d entries %16llu bytes %6.2f%%\n", "intern table", vm.strings.count,
+        (unsigned long long)internBytes, percent(internBytes, total));
+    fprintf(file, "%-20s %29llu bytes %6.2f%%\n", "compile arena", (unsigned long long)arenaBytes,
+        percent(arenaBytes, total));
+    // the scanner window while compiling, and whatever a host allocated through reallocate()
+    if (total > accounted) {
+        fprintf(file, "%-20s %29llu bytes %6.2f%%\n", "other", (unsigned long long)(total - accounted),
+            percent(total - accounted, total));
+    }
+}
+
+void writeAllocationProfile(FILE* file) {
+    AllocationSlot* sorted = malloc(sizeof(slots));
+    int count = 0;
+    uint64_t totalCount = droppedCount;
+    uint64_t totalBytes = droppedBytes;
+    if (sorted != NULL) {
+        for (int i = 0; i < ALLOCATION_SLOTS; i++) {
+            if (slots[i].site == NULL) continue;
+            sorted[count++] = slots[i];
+            totalCount += slots[i].count;
+            totalBytes += slots[i].bytes;
+        }
+        qsort(sorted, (size_t)count, sizeof(AllocationSlot), compareBytes);
+    }
+
+    fprintf(file, "== allocations: %llu, %llu bytes ==\n", (unsigned long long)totalCount,
+        (unsigned long long)totalBytes);
+    writeAllocators(file, sorted, count, totalBytes);
+    if (droppedCount > 0) {
+        fprintf(file, "(dropped: %llu allocations, %llu bytes, too many distinct sites)\n",
+            (unsigned long long)droppedCount, (unsigned long long)droppedBytes);
+    }
+    writeSites(file, sorted, count, totalBytes);
+    free(sorted);
+
+    writeLiveHeap(file);
+}
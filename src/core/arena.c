@@ -0,0 +1,93 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include "siew/arena.h"
+
+#include <string.h>
+
+#include "siew/memory.h"
+
+// Every piece is rounded up to this, and data is aligned to it (see ArenaBlock), so every pointer we hand out
+// is as aligned as one from malloc.
+#define ARENA_ALIGNMENT _Alignof(max_align_t)
+#define ARENA_MIN_BLOCK (16 * 1024)
+
+#define ALIGN_UP(size) (((size) + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+void initArena(Arena* arena) {
+    arena->blocks = NULL;
+}
+
+static void addBlock(Arena* arena, size_t size) {
+    size_t capacity = size < ARENA_MIN_BLOCK ? ARENA_MIN_BLOCK : size;
+    ArenaBlock* block = (ArenaBlock*)reallocate(NULL, 0, sizeof(ArenaBlock) + capacity);
+    block->capacity = capacity;
+    block->used = 0;
+    block->next = arena->blocks;
+    arena->blocks = block;
+}
+
+void* arenaAllocate(Arena* arena, size_t size) {
+    size = ALIGN_UP(size);
+
+    ArenaBlock* block = arena->blocks;
+    if (block == NULL || block->capacity - block->used < size) {
+        // we don't look for holes in the older blocks, we just start a new one.
+        // Growing by (at least) the double keeps the number of blocks logarithmic.
+        size_t previous = block == NULL ? 0 : block->capacity;
+        addBlock(arena, size > previous * 2 ? size : previous * 2);
+        block = arena->blocks;
+    }
+
+    void* result = block->data + block->used;
+    block->used += size;
+    return result;
+}
+
+void* arenaReallocate(Arena* arena, void* pointer, size_t oldSize, size_t newSize) {
+    if (arena == NULL) return reallocate(pointer, oldSize, newSize);
+
+    // freeing inside an arena is a no-op, the memory comes back when the arena is reset
+    if (newSize == 0) return NULL;
+
+    ArenaBlock* block = arena->blocks;
+    // If the pointer is the last thing we handed out, we can simply move the bump pointer.
+    // This is the common case when a single array keeps growing.
+    if (pointer != NULL && block != NULL &&
+        (uint8_t*)pointer + ALIGN_UP(oldSize) == block->data + block->used &&
+        (size_t)((uint8_t*)pointer - block->data) + ALIGN_UP(newSize) <= block->capacity) {
+        block->used = (size_t)((uint8_t*)pointer - block->data) + ALIGN_UP(newSize);
+        return pointer;
+    }
+
+    void* result = arenaAllocate(arena, newSize);
+    if (pointer != NULL) memcpy(result, pointer, oldSize < newSize ? oldSize : newSize);
+    return result;
+}
+
+void resetArena(Arena* arena) {
+    if (arena->blocks == NULL) return;
+
+    // We keep the newest block (the biggest one) so the next compilation doesn't have to ask
+    // the allocator for anything at all. The rest goes back to the system.
+    ArenaBlock* block = arena->blocks->next;
+    while (block != NULL) {
+        ArenaBlock* next = block->next;
+        reallocate(block, sizeof(ArenaBlock) + block->capacity, 0);
+        block = next;
+    }
+
+    arena->blocks->next = NULL;
+    arena->blocks->used = 0;
+}
+
+void freeArena(Arena* arena) {
+    ArenaBlock* block = arena->blocks;
+    while (block != NULL) {
+        ArenaBlock* next = block->next;
+        reallocate(block, sizeof(ArenaBlock) + block->capacity, 0);
+        block = next;
+    }
+    initArena(arena);
+}
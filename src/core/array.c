@@ -0,0 +1,187 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include "siew/array.h"
+
+#include <math.h>
+
+// Same gate as the scanner: SSE2 is there on every x86-64, AVX2 only when the compiler is allowed to use it.
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__AVX2__))
+#define ARRAY_SIMD
+#include <immintrin.h>
+#endif
+
+// the scalar loops are the reference, we keep them around to compare against
+static bool useVectorized = true;
+
+void setArrayVectorized(bool enabled) {
+    useVectorized = enabled;
+}
+
+#ifdef ARRAY_SIMD
+// The few operations the kernels need, for both widths, so each kernel is written only once.
+// All the loads and stores are unaligned: the elements of an ObjArray start right after its header.
+#ifdef __AVX2__
+typedef __m256d Lanes;
+#define LANE_COUNT 4
+#define LANES_LOAD(p)        _mm256_loadu_pd(p)
+#define LANES_STORE(p, v)    _mm256_storeu_pd(p, v)
+#define LANES_SPLAT(x)       _mm256_set1_pd(x)
+#define LANES_ADD(a, b)      _mm256_add_pd(a, b)
+#define LANES_SUB(a, b)      _mm256_sub_pd(a, b)
+#define LANES_MUL(a, b)      _mm256_mul_pd(a, b)
+#define LANES_DIV(a, b)      _mm256_div_pd(a, b)
+#define LANES_MIN(a, b)      _mm256_min_pd(a, b)
+#define LANES_MAX(a, b)      _mm256_max_pd(a, b)
+#define LANES_LESS(a, b)     _mm256_cmp_pd(a, b, _CMP_LT_OQ)
+#define LANES_GREATER(a, b)  _mm256_cmp_pd(a, b, _CMP_GT_OQ)
+#define LANES_EQUAL(a, b)    _mm256_cmp_pd(a, b, _CMP_EQ_OQ)
+#define LANES_AND(a, b)      _mm256_and_pd(a, b)
+#else
+typedef __m128d Lanes;
+#define LANE_COUNT 2
+#define LANES_LOAD(p)        _mm_loadu_pd(p)
+#define LANES_STORE(p, v)    _mm_storeu_pd(p, v)
+#define LANES_SPLAT(x)       _mm_set1_pd(x)
+#define LANES_ADD(a, b)      _mm_add_pd(a, b)
+#define LANES_SUB(a, b)      _mm_sub_pd(a, b)
+#define LANES_MUL(a, b)      _mm_mul_pd(a, b)
+#define LANES_DIV(a, b)      _mm_div_pd(a, b)
+#define LANES_MIN(a, b)      _mm_min_pd(a, b)
+#define LANES_MAX(a, b)      _mm_max_pd(a, b)
+#define LANES_LESS(a, b)     _mm_cmplt_pd(a, b)
+#define LANES_GREATER(a, b)  _mm_cmpgt_pd(a, b)
+#define LANES_EQUAL(a, b)    _mm_cmpeq_pd(a, b)
+#define LANES_AND(a, b)      _mm_and_pd(a, b)
+#endif
+
+// a comparison gives all ones or all zeros in each lane, and all ones AND 1.0 is 1.0
+#define LANES_MASK(compare) LANES_AND(compare, LANES_SPLAT(1.0))
+
+static inline double sumLanes(Lanes lanes) {
+    double values[LANE_COUNT];
+    LANES_STORE(values, lanes);
+    double sum = 0;
+    for (int i = 0; i < LANE_COUNT; i++) sum += values[i];
+    return sum;
+}
+#endif
+
+// Every elementwise kernel is the same loop: whole blocks of lanes while there are, the scalar operation for the rest
+// (or for everything, without SIMD or when it's turned off).
+#ifdef ARRAY_SIMD
+#define ELEMENTWISE_KERNEL(name, lanesOp, scalarOp) \
+    void name(double* out, const double* a, const double* b, int count) { \
+        int i = 0; \
+        if (useVectorized) { \
+            for (; i + LANE_COUNT <= count; i += LANE_COUNT) { \
+                LANES_STORE(out + i, lanesOp(LANES_LOAD(a + i), LANES_LOAD(b + i))); \
+            } \
+        } \
+        for (; i < count; i++) out[i] = scalarOp(a[i], b[i]); \
+    }
+#else
+#define ELEMENTWISE_KERNEL(name, lanesOp, scalarOp) \
+    void name(double* out, const double* a, const double* b, int count) { \
+        for (int i = 0; i < count; i++) out[i] = scalarOp(a[i], b[i]); \
+    }
+#endif
+
+#define SCALAR_ADD(a, b)      ((a) + (b))
+#define SCALAR_SUB(a, b)      ((a) - (b))
+#define SCALAR_MUL(a, b)      ((a) * (b))
+#define SCALAR_DIV(a, b)      ((a) / (b))
+#define SCALAR_LESS(a, b)     ((a) < (b) ? 1.0 : 0.0)
+#define SCALAR_GREATER(a, b)  ((a) > (b) ? 1.0 : 0.0)
+#define SCALAR_EQUAL(a, b)    ((a) == (b) ? 1.0 : 0.0)
+
+#define LESS_MASK(a, b)     LANES_MASK(LANES_LESS(a, b))
+#define GREATER_MASK(a, b)  LANES_MASK(LANES_GREATER(a, b))
+#define EQUAL_MASK(a, b)    LANES_MASK(LANES_EQUAL(a, b))
+
+ELEMENTWISE_KERNEL(arrayAdd, LANES_ADD, SCALAR_ADD)
+ELEMENTWISE_KERNEL(arraySubtract, LANES_SUB, SCALAR_SUB)
+ELEMENTWISE_KERNEL(arrayMultiply, LANES_MUL, SCALAR_MUL)
+ELEMENTWISE_KERNEL(arrayDivide, LANES_DIV, SCALAR_DIV)
+ELEMENTWISE_KERNEL(arrayLessMask, LESS_MASK, SCALAR_LESS)
+ELEMENTWISE_KERNEL(arrayGreaterMask, GREATER_MASK, SCALAR_GREATER)
+ELEMENTWISE_KERNEL(arrayEqualMask, EQUAL_MASK, SCALAR_EQUAL)
+
+// Sums and dot products: each add has to wait for the one before it, so with a single sum the adder sits idle
+// most of the time. Four independent sums (of LANE_COUNT lanes each) keep it busy, and they are added up at the end.
+double arraySum(const double* values, int count) {
+    int i = 0;
+    double sum = 0;
+#ifdef ARRAY_SIMD
+    if (useVectorized) {
+        Lanes sum0 = LANES_SPLAT(0), sum1 = LANES_SPLAT(0), sum2 = LANES_SPLAT(0), sum3 = LANES_SPLAT(0);
+        for (; i + 4 * LANE_COUNT <= count; i += 4 * LANE_COUNT) {
+            sum0 = LANES_ADD(sum0, LANES_LOAD(values + i));
+            sum1 = LANES_ADD(sum1, LANES_LOAD(values + i + LANE_COUNT));
+            sum2 = LANES_ADD(sum2, LANES_LOAD(values + i + 2 * LANE_COUNT));
+            sum3 = LANES_ADD(sum3, LANES_LOAD(values + i + 3 * LANE_COUNT));
+        }
+        sum = sumLanes(LANES_ADD(LANES_ADD(sum0, sum1), LANES_ADD(sum2, sum3)));
+    }
+#endif
+    for (; i < count; i++) sum += values[i];
+    return sum;
+}
+
+double arrayDot(const double* a, const double* b, int count) {
+    int i = 0;
+    double sum = 0;
+#ifdef ARRAY_SIMD
+    if (useVectorized) {
+        Lanes sum0 = LANES_SPLAT(0), sum1 = LANES_SPLAT(0), sum2 = LANES_SPLAT(0), sum3 = LANES_SPLAT(0);
+        for (; i + 4 * LANE_COUNT <= count; i += 4 * LANE_COUNT) {
+            sum0 = LANES_ADD(sum0, LANES_MUL(LANES_LOAD(a + i), LANES_LOAD(b + i)));
+            sum1 = LANES_ADD(sum1, LANES_MUL(LANES_LOAD(a + i + LANE_COUNT), LANES_LOAD(b + i + LANE_COUNT)));
+            sum2 = LANES_ADD(sum2, LANES_MUL(LANES_LOAD(a + i + 2 * LANE_COUNT), LANES_LOAD(b + i + 2 * LANE_COUNT)));
+            sum3 = LANES_ADD(sum3, LANES_MUL(LANES_LOAD(a + i + 3 * LANE_COUNT), LANES_LOAD(b + i + 3 * LANE_COUNT)));
+        }
+        sum = sumLanes(LANES_ADD(LANES_ADD(sum0, sum1), LANES_ADD(sum2, sum3)));
+    }
+#endif
+    for (; i < count; i++) sum += a[i] * b[i];
+    return sum;
+}
+
+// The scalar step is "x < best ? x : best", and that is exactly what min_pd(x, best) does in each lane: a NaN x
+// loses, a NaN best stays. Every lane starts at values[0], so a NaN there wins everywhere, like in the scalar loop.
+// Only a tie between 0 and -0 can come out with the other sign.
+#define MIN_STEP(x, best) ((x) < (best) ? (x) : (best))
+#define MAX_STEP(x, best) ((x) > (best) ? (x) : (best))
+
+#ifdef ARRAY_SIMD
+#define REDUCE_KERNEL(name, lanesOp, scalarStep) \
+    double name(const double* values, int count) { \
+        if (count == 0) return NAN; \
+        double best = values[0]; \
+        int i = 1; \
+        if (useVectorized && count >= 2 * LANE_COUNT) { \
+            Lanes best0 = LANES_SPLAT(best), best1 = best0; \
+            for (; i + 2 * LANE_COUNT <= count; i += 2 * LANE_COUNT) { \
+                best0 = lanesOp(LANES_LOAD(values + i), best0); \
+                best1 = lanesOp(LANES_LOAD(values + i + LANE_COUNT), best1); \
+            } \
+            double lanes[LANE_COUNT]; \
+            LANES_STORE(lanes, lanesOp(best1, best0)); \
+            for (int lane = 0; lane < LANE_COUNT; lane++) best = scalarStep(lanes[lane], best); \
+        } \
+        for (; i < count; i++) best = scalarStep(values[i], best); \
+        return best; \
+    }
+#else
+#define REDUCE_KERNEL(name, lanesOp, scalarStep) \
+    double name(const double* values, int count) { \
+        if (count == 0) return NAN; \
+        double best = values[0]; \
+        for (int i = 1; i < count; i++) best = scalarStep(values[i], best); \
+        return best; \
+    }
+#endif
+
+REDUCE_KERNEL(arrayMin, LANES_MIN, MIN_STEP)
+REDUCE_KERNEL(arrayMax, LANES_MAX, MAX_STEP)
@@ -5,6 +5,9 @@
 #include <siew/chunk.h>
 
 #include "siew/memory.h"
+#include "siew/vm.h"
+
+#define CHUNK_SIZE_HINT_MAX 4096
 
 
 void initChunk(Chunk* chunk) {
@@ -12,12 +15,44 @@ void initChunk(Chunk* chunk) {
     chunk->capacity = 0;
     chunk->code = NULL;
     chunk->lines = NULL;
+    chunk->arena = NULL;
+    chunk->maxStack = 0;
+    chunk->verified = false;
+    chunk->backend = BACKEND_STACK;
     initValueArray(&chunk->constants);
 }
 
+void initChunkInArena(Chunk* chunk, Arena* arena, int sourceLength) {
+    initChunk(chunk);
+    chunk->arena = arena;
+    chunk->constants.arena = arena;
+
+    // We already know roughly how much code is coming: every token is at least one char and
+    // emits at most two bytes (OP_CONSTANT + index), and most of them are followed by a space.
+    // OP_NUMBER is the exception (nine bytes), but a literal that needs it is rarely shorter than "0.5".
+    // So one byte of code per byte of source is a generous guess. Sizing the buffers up front
+    // means most compilations never grow them at all.
+    // For big sources we stop guessing at some point: they would reserve (4 + 1) bytes per source byte
+    // before knowing if they need them, and for those a few extra grow steps don't matter.
+    chunk->capacity = sourceLength < CHUNK_SIZE_HINT_MAX - 8 ? sourceLength + 8 : CHUNK_SIZE_HINT_MAX;
+    ENTER_ALLOCATION_SITE("chunk growth");
+    chunk->code = ARENA_GROW_ARRAY(arena, uint8_t, NULL, 0, chunk->capacity);
+    chunk->lines = ARENA_GROW_ARRAY(arena, int, NULL, 0, chunk->capacity);
+
+    // a constant needs at least a char and a separator. OP_CONSTANT can't address more than 256 anyway.
+    int constants = sourceLength / 2 + 1;
+    if (constants > UINT8_MAX + 1) constants = UINT8_MAX + 1;
+    chunk->constants.capacity = constants;
+    chunk->constants.values = ARENA_GROW_ARRAY(arena, Value, NULL, 0, constants);
+    LEAVE_ALLOCATION_SITE();
+}
+
 void freeChunk(Chunk* chunk) {
-    FREE_ARRAY(uint8_t, chunk->code, chunk->capacity);
-    FREE_ARRAY(int, chunk->lines, chunk->capacity);
+    // arena memory is not ours to free, it is released all at once with the arena
+    if (chunk->arena == NULL) {
+        FREE_ARRAY(uint8_t, chunk->code, chunk->capacity);
+        FREE_ARRAY(int, chunk->lines, chunk->capacity);
+    }
     freeValueArray(&chunk->constants);
     initChunk(chunk);
 }
@@ -32,8 +67,10 @@ void writeChunk(Chunk* chunk, uint8_t byte, int line) {
     if (chunk->capacity < chunk->count + 1) {
         int oldCapacity = chunk->capacity;
         chunk->capacity = GROW_CAPACITY(oldCapacity);
-        chunk->code = GROW_ARRAY(uint8_t, chunk->code, oldCapacity, chunk->capacity);
-        chunk->lines = GROW_ARRAY(int, chunk->lines, oldCapacity, chunk->capacity);
+        ENTER_ALLOCATION_SITE("chunk growth");
+        chunk->code = ARENA_GROW_ARRAY(chunk->arena, uint8_t, chunk->code, oldCapacity, chunk->capacity);
+        chunk->lines = ARENA_GROW_ARRAY(chunk->arena, int, chunk->lines, oldCapacity, chunk->capacity);
+        LEAVE_ALLOCATION_SITE();
     }
 
     chunk->code[chunk->count] = byte;
@@ -42,7 +79,66 @@ void writeChunk(Chunk* chunk, uint8_t byte, int line) {
 }
 
 int addConstant(Chunk* chunk, Value value) {
+    // the value is not in the constants yet, and growing them can trigger a collection. The stack keeps it alive meanwhile.
+    push(value);
     writeValueArray(&chunk->constants, value);
+    pop();
 
     return chunk->constants.count - 1;
-}
\ No newline at end of file
+}
+
+#define OPERAND_BYTES(operand) \
+    ((operand) == OPERAND_NONE ? 0 : (operand) == OPERAND_DOUBLE ? (int)sizeof(double) : \
+     (operand) == OPERAND_INT32 ? (int)sizeof(int32_t) : 1)
+#define OPCODE_INFO(name, operand, inputs, effect) {#name, operand, OPERAND_BYTES(operand), inputs, effect},
+
+const OpcodeInfo opcodeInfo[OP_COUNT] = {
+    FOR_EACH_OPCODE(OPCODE_INFO)
+};
+
+#undef OPCODE_INFO
+#undef OPERAND_BYTES
+
+const char* opName(uint8_t instruction) {
+    return instruction < OP_COUNT ? opcodeInfo[instruction].name : NULL;
+}
+
+OperandKind opOperandKind(uint8_t instruction) {
+    return instruction < OP_COUNT ? opcodeInfo[instruction].operand : OPERAND_NONE;
+}
+
+// a byte that is not an opcode has no operands and doesn't touch the stack, the verifier rejects it anyway
+int opOperandCount(uint8_t instruction) {
+    return instruction < OP_COUNT ? opcodeInfo[instruction].operandBytes : 0;
+}
+
+int opStackInputs(uint8_t instruction) {
+    return instruction < OP_COUNT ? opcodeInfo[instruction].inputs : 0;
+}
+
+int opStackEffect(uint8_t instruction) {
+    return instruction < OP_COUNT ? opcodeInfo[instruction].effect : 0;
+}
+
+#define REGISTER_OPERAND_BYTES(form) \
+    ((form) == REGISTER_BINARY ? 6 : (form) == REGISTER_UNARY ? 4 : (form) == REGISTER_LOAD_NUMBER ? 2 + (int)sizeof(double) : 2)
+#define REGISTER_OPCODE_INFO(name, form, stackOp) {#name, form, REGISTER_OPERAND_BYTES(form), stackOp},
+
+const RegisterOpcodeInfo registerOpcodeInfo[REGISTER_OP_COUNT] = {
+    FOR_EACH_REGISTER_OPCODE(REGISTER_OPCODE_INFO)
+};
+
+#undef REGISTER_OPCODE_INFO
+#undef REGISTER_OPERAND_BYTES
+
+const char* registerOpName(uint8_t instruction) {
+    return instruction < REGISTER_OP_COUNT ? registerOpcodeInfo[instruction].name : NULL;
+}
+
+RegisterForm registerOpForm(uint8_t instruction) {
+    return instruction < REGISTER_OP_COUNT ? registerOpcodeInfo[instruction].form : REGISTER_RETURN;
+}
+
+int registerOperandCount(uint8_t instruction) {
+    return instruction < REGISTER_OP_COUNT ? registerOpcodeInfo[instruction].operandBytes : 0;
+}
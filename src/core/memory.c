@@ -1,42 +1,183 @@
 //
 // Created by augus on 9/22/2025.
 //
+#include <stdio.h>
 #include <stdlib.h>
 #include "siew/memory.h"
 
+#include "siew/allocprofile.h"
+#include "siew/compiler.h"
 #include "siew/object.h"
 #include "siew/value.h"
 #include "siew/vm.h"
 
+const char* allocationSite = NULL;
+
+static void outOfMemory(size_t oldSize, size_t newSize) {
+    // the allocation never happened, so it doesn't count
+    vm.bytesAllocated -= newSize - oldSize;
+
+    // Nobody can catch it (we are not inside interpret()), so we do what we always did.
+    if (vm.outOfMemoryJump == NULL) exit(1);
+
+    longjmp(*vm.outOfMemoryJump, 1);
+}
+
 void* reallocate(void* pointer, size_t oldSize, size_t newSize) {
+    // every single byte of the VM goes through here, so this is the place to keep the accounts
+    vm.bytesAllocated += newSize;
+    vm.bytesAllocated -= oldSize;
+
+    if (newSize > oldSize) {
+#ifdef DEBUG_STRESS_GC
+        collectGarbage();
+#endif
+        // Over the limit: maybe most of the heap is garbage, so we collect before giving up.
+        if (vm.heapLimit > 0 && vm.bytesAllocated > vm.heapLimit) {
+            collectGarbage();
+            if (vm.bytesAllocated > vm.heapLimit) outOfMemory(oldSize, newSize);
+        }
+    }
+
     // if the new size we want to allocate is 0 that means that
     // we need to free space, we don't need it anymore.
     if (newSize == 0) {
+        vm.stats.freedBytes += oldSize;
         free(pointer);
         return NULL;
     }
 
     void* result = realloc(pointer, newSize);
 
-    // if there is no memory, realloc returns null,
-    // we exit in that case
+    // if there is no memory, realloc returns null.
+    // Same as with the limit: we try to make room with a collection, and if that's not enough, it is an error.
     if (result == NULL) {
-        exit(1);
+        collectGarbage();
+        result = realloc(pointer, newSize);
+        if (result == NULL) outOfMemory(oldSize, newSize);
     }
 
+    if (newSize > oldSize) {
+        vm.stats.allocations++;
+        vm.stats.allocatedBytes += newSize - oldSize;
+        if (vm.bytesAllocated > vm.stats.peakBytes) vm.stats.peakBytes = vm.bytesAllocated;
+        if (allocationProfiling) recordAllocation(oldSize, newSize);
+    } else {
+        vm.stats.freedBytes += oldSize - newSize;
+    }
     return result;
 }
 
 static void freeObject(Obj* object) {
+    vm.stats.liveObjects[object->type]--;
+
     switch (object->type) {
-        case OBJ_STRING:
+        case OBJ_STRING: {
             ObjString* string = (ObjString*)object;
-            FREE_ARRAY(string->chars, string->chars, string->length);
+            // Only flat strings own their chars. Ropes that were never flattened have none, and slices
+            // borrow them from their parent. Children and parents are in the objects list too, they are freed on their own.
+            // (copyString() makes the object before its chars, for a moment a flat string can have none)
+            if (string->kind == STRING_FLAT && string->chars != NULL) FREE_ARRAY(char, string->chars, string->length + 1);
             FREE(ObjString, object);
             break;
+        }
+        case OBJ_ARRAY:
+            reallocate(object, arrayBytes(((ObjArray*)object)->count), 0);
+            break;
     }
 }
 
+void markObject(Obj* object) {
+    if (object == NULL) return;
+    if (object->isMarked) return;
+    object->isMarked = true;
+
+    // We don't trace the references right away, deep ropes would recurse too deep.
+    // The object goes to the gray stack and traceReferences() takes care of it later.
+    // This stack uses the system realloc on purpose: allocating through reallocate() could start
+    // another collection in the middle of this one.
+    if (vm.grayCapacity < vm.grayCount + 1) {
+        vm.grayCapacity = GROW_CAPACITY(vm.grayCapacity);
+        vm.grayStack = (Obj**)realloc(vm.grayStack, sizeof(Obj*) * vm.grayCapacity);
+        if (vm.grayStack == NULL) exit(1);
+    }
+
+    vm.grayStack[vm.grayCount++] = object;
+}
+
+void markValue(Value value) {
+    if (IS_OBJ(value)) markObject(AS_OBJ(value));
+}
+
+static void blackenObject(Obj* object) {
+    switch (object->type) {
+        case OBJ_STRING: {
+            ObjString* string = (ObjString*)object;
+            // a rope needs its children to ever be flattened, and a slice borrows the bytes of its parent
+            markObject((Obj*)string->left);
+            markObject((Obj*)string->right);
+            markObject((Obj*)string->parent);
+            break;
+        }
+        // only doubles inside, nothing to mark
+        case OBJ_ARRAY: break;
+    }
+}
+
+static void markRoots() {
+    for (Value* slot = vm.stack; slot < vm.stackTop; slot++) {
+        markValue(*slot);
+    }
+
+    if (vm.chunk != NULL) {
+        for (int i = 0; i < vm.chunk->constants.count; i++) {
+            markValue(vm.chunk->constants.values[i]);
+        }
+    }
+
+    markCompilerRoots();
+}
+
+static void traceReferences() {
+    while (vm.grayCount > 0) {
+        Obj* object = vm.grayStack[--vm.grayCount];
+        blackenObject(object);
+    }
+}
+
+static void sweep() {
+    Obj* previous = NULL;
+    Obj* object = vm.objects;
+    while (object != NULL) {
+        if (object->isMarked) {
+            // survivor, we clean the mark for the next collection
+            object->isMarked = false;
+            previous = object;
+            object = object->next;
+        } else {
+            Obj* unreached = object;
+            object = object->next;
+            if (previous != NULL) {
+                previous->next = object;
+            } else {
+                vm.objects = object;
+            }
+
+            freeObject(unreached);
+        }
+    }
+}
+
+// A simple mark-sweep collector: we mark everything reachable from the roots and free the rest.
+// For now it only runs when we hit vm.heapLimit (or the system runs out of memory).
+void collectGarbage() {
+    vm.stats.collections++;
+    markRoots();
+    traceReferences();
+    tableRemoveWhite(&vm.strings);
+    sweep();
+}
+
 void freeObjects() {
     Obj* object = vm.objects;
 
@@ -2,10 +2,12 @@
 // Created by augus on 11/25/2025.
 //
 
+#include <limits.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "siew/memory.h"
+#include "siew/number.h"
 #include "siew/object.h"
 #include "siew/value.h"
 #include "siew/vm.h"
@@ -22,9 +24,11 @@
 static Obj* allocateObject(size_t size, ObjType type) {
     Obj* object = (Obj*)reallocate(NULL, 0, size);
     object->type = type;
+    object->isMarked = false;
 
     object->next = vm.objects;
     vm.objects = object;
+    vm.stats.liveObjects[type]++;
 
     return object;
 }
@@ -33,24 +37,79 @@ static ObjString* allocateString(char* chars, int length, uint32_t hash) {
     // we can think of this function as the constructor of a OOP language
     // first we create the base class obj, then we initialize the child class (ObjString)
     ObjString* string = ALLOCATE_OBJ(ObjString, OBJ_STRING);
+    string->kind = STRING_FLAT;
     string->length = length;
     string->chars = chars;
     string->hash = hash;
+    string->hashed = true;
+    string->interned = true;
+    string->left = NULL;
+    string->right = NULL;
+    string->parent = NULL;
+
+    // growing the intern table may trigger a collection, and right now nothing points at this string.
+    // So we keep it on the stack for a moment, that way the GC can see it.
+    push(OBJ_VAL(string));
     tableSet(&vm.strings, string, NIL_VAL);
+    pop();
     return string;
 }
 
-static uint32_t hashString(const char* chars, int length) {
-    uint32_t hash = 2166136261u;
-    for (int i = 0; i < length; i++) {
-        hash ^= chars[i];
-        hash *= 16777619;
-    }
-    return hash;
+// Same as allocateString but without hashing or interning anything (INTERN_LAZY).
+// Whoever needs the hash or the canonical instance later will compute it on demand.
+static ObjString* allocateLazyString(char* chars, int length) {
+    ObjString* string = ALLOCATE_OBJ(ObjString, OBJ_STRING);
+    string->kind = STRING_FLAT;
+    string->length = length;
+    string->chars = chars;
+    string->hash = 0;
+    string->hashed = false;
+    string->interned = false;
+    string->left = NULL;
+    string->right = NULL;
+    string->parent = NULL;
+    return string;
+}
+
+static ObjString* allocateRope(ObjString* left, ObjString* right) {
+    // A rope is a promise: "I am left followed by right". No bytes are copied, nothing is hashed
+    // and nothing goes into the intern table. All of that waits until somebody actually looks at it.
+    ObjString* string = ALLOCATE_OBJ(ObjString, OBJ_STRING);
+    string->kind = STRING_ROPE;
+    string->length = left->length + right->length;
+    string->chars = NULL;
+    string->hash = 0;
+    string->hashed = false;
+    string->interned = false;
+    string->left = left;
+    string->right = right;
+    string->parent = NULL;
+    return string;
+}
+
+static ObjString* allocateSlice(ObjString* parent, int start, int length) {
+    // A slice borrows its bytes from the parent buffer. Those bytes are NOT followed by a '\0',
+    // so anyone who wants a C string has to go through stringChars(), which makes a real copy.
+    ObjString* string = ALLOCATE_OBJ(ObjString, OBJ_STRING);
+    string->kind = STRING_SLICE;
+    string->length = length;
+    string->chars = parent->chars + start;
+    string->hash = 0;
+    string->hashed = false;
+    string->interned = false;
+    string->left = NULL;
+    string->right = NULL;
+    // this reference is what keeps the parent (and therefore our bytes) alive
+    string->parent = parent;
+    return string;
 }
 
 ObjString* copyString(const char* chars, int length) {
-    uint32_t hash = hashString(chars, length);
+    return copyStringHashed(chars, length, hashString(chars, length));
+}
+
+// Same as copyString, for callers that already know the hash (the compiler gets it from the scanner).
+ObjString* copyStringHashed(const char* chars, int length, uint32_t hash) {
     // The core idea here is to ensure that only one instance of each distinct string
     // exists in memory.
     //
@@ -68,6 +127,12 @@ ObjString* copyString(const char* chars, int length) {
     ObjString* interned = tableFindString(&vm.strings, chars, length, hash);
 
     if (interned != NULL) return interned;
+    ENTER_ALLOCATION_SITE("copyString");
+    // The object goes first. Over the heap limit an allocation doesn't return, it jumps back to interpretChunk(),
+    // and chars allocated before a failed object would belong to nobody. An empty string without chars owns nothing,
+    // and from the moment it has them, freeing it frees them too. It stays on the stack until it is in the intern table.
+    ObjString* string = allocateLazyString(NULL, 0);
+    push(OBJ_VAL(string));
     char* heapChars = ALLOCATE(char, length + 1); // + 1 to add the terminator byte
     memcpy(heapChars, chars, length);
 
@@ -79,24 +144,226 @@ ObjString* copyString(const char* chars, int length) {
     // library functions that expect null-terminated strings. So we manually append
     // the '\0' here before creating the ObjString.
     heapChars[length] = '\0';
-    return allocateString(heapChars, length, hash);
+    string->chars = heapChars;
+    string->length = length;
+    string->hash = hash;
+    string->hashed = true;
+    string->interned = true;
+    tableSet(&vm.strings, string, NIL_VAL);
+    pop();
+    LEAVE_ALLOCATION_SITE();
+    return string;
+}
+
+// a and b must be reachable by the GC (on the stack, for example), allocating the rope can trigger a collection.
+ObjString* concatenateStrings(ObjString* a, ObjString* b) {
+    // No point in creating a node to glue something with nothing.
+    if (a->length == 0) return b;
+    if (b->length == 0) return a;
+    // lengths are ints, and everything that walks a rope trusts its length (copyRopeChars(), flattenString()...)
+    if (a->length > INT_MAX - b->length) return NULL;
+
+    return allocateRope(a, b);
+}
+
+// Copies the bytes of a string (flat, slice or rope) into dest.
+// Scripts build strings like s + "a" + "b" + ..., which gives us ropes that lean to the left,
+// potentially millions of nodes deep. Recursing on the left would blow the C stack, so we walk the
+// left spine with a loop, filling dest from the end backwards, and only recurse on the right children,
+// which are usually the small pieces.
+static void copyRopeChars(ObjString* string, char* dest) {
+    char* end = dest + string->length;
+
+    while (string->kind == STRING_ROPE) {
+        ObjString* right = string->right;
+        end -= right->length;
+
+        if (right->kind == STRING_ROPE) {
+            copyRopeChars(right, end);
+        } else {
+            memcpy(end, right->chars, right->length);
+        }
+
+        string = string->left;
+    }
+
+    memcpy(dest, string->chars, string->length);
+}
+
+// Makes sure string->chars points to the bytes of the string. Only ropes have work to do here,
+// flat strings and slices already have their bytes (although slices are not NUL-terminated).
+static void flattenString(ObjString* string) {
+    if (string->kind != STRING_ROPE) return;
+
+    ENTER_ALLOCATION_SITE("flattenString");
+    char* chars = ALLOCATE(char, string->length + 1);
+    LEAVE_ALLOCATION_SITE();
+    copyRopeChars(string, chars);
+    chars[string->length] = '\0';
+
+    // From now on this is an ordinary flat string, the children are not needed by us anymore.
+    string->kind = STRING_FLAT;
+    string->chars = chars;
+    string->left = NULL;
+    string->right = NULL;
+}
+
+// Gives the slice its own NUL-terminated copy of the bytes and lets go of the parent.
+static void materializeSlice(ObjString* string) {
+    ENTER_ALLOCATION_SITE("materializeSlice");
+    char* chars = ALLOCATE(char, string->length + 1);
+    LEAVE_ALLOCATION_SITE();
+    memcpy(chars, string->chars, string->length);
+    chars[string->length] = '\0';
+
+    string->kind = STRING_FLAT;
+    string->chars = chars;
+    string->parent = NULL;
+}
+
+ObjString* sliceString(ObjString* string, int start, int length) {
+    // a host API too: a slice that reaches out of the parent would read (and later copy) someone else's bytes
+    if (start < 0 || length < 0 || start > string->length - length) return NULL;
+    if (start == 0 && length == string->length) return string;
+
+    // we need the parent bytes to exist, so a rope gets flattened here
+    flattenString(string);
+
+    // A slice of a slice points straight at the original buffer, this way we never build
+    // chains of slices and each slice keeps only one parent alive.
+    if (string->kind == STRING_SLICE) {
+        start += (int)(string->chars - string->parent->chars);
+        string = string->parent;
+    }
+
+    ENTER_ALLOCATION_SITE("sliceString");
+    ObjString* slice = allocateSlice(string, start, length);
+    LEAVE_ALLOCATION_SITE();
+    return slice;
+}
+
+char* stringChars(ObjString* string) {
+    flattenString(string);
+    // callers of this function want a C string, that means a '\0' at the end, so slices must own their bytes
+    if (string->kind == STRING_SLICE) materializeSlice(string);
+    return string->chars;
+}
+
+uint32_t stringHash(ObjString* string) {
+    if (!string->hashed) {
+        flattenString(string);
+        string->hash = hashString(string->chars, string->length);
+        string->hashed = true;
+    }
+    return string->hash;
+}
+
+// Returns the one instance of this string that lives in the intern table.
+// A flattened rope may have the same contents as a string that was interned before it, we can't
+// swap every reference to the rope, so instead we hand back the canonical one and compare that.
+ObjString* internString(ObjString* string) {
+    if (string->interned) return string;
+
+    uint32_t hash = stringHash(string);
+    ObjString* interned = tableFindString(&vm.strings, string->chars, string->length, hash);
+    if (interned != NULL) return interned;
+
+    string->interned = true;
+    push(OBJ_VAL(string));
+    tableSet(&vm.strings, string, NIL_VAL);
+    pop();
+    return string;
+}
+
+bool stringsEqual(ObjString* a, ObjString* b) {
+    if (a == b) return true;
+    // Different lengths can never be equal, and we can know that without flattening anything.
+    if (a->length != b->length) return false;
+    // Two canonical instances at different addresses must have different contents.
+    if (a->interned && b->interned) return false;
+
+    if (vm.internPolicy == INTERN_EAGER) return internString(a) == internString(b);
+
+    // INTERN_LAZY: we compare the contents without putting anything in the intern table.
+    // If both hashes are already known they are a free early exit. We don't compute them just for
+    // this, hashing is a full pass over the bytes, the same price as the memcmp itself.
+    if (a->hashed && b->hashed && a->hash != b->hash) return false;
+    // memcmp doesn't need the '\0', so a slice can be compared in place, no need to materialize it
+    flattenString(a);
+    flattenString(b);
+    return memcmp(a->chars, b->chars, a->length) == 0;
 }
 
 ObjString* takeString(char* chars, int length) {
-    uint32_t hash = hashString(chars, length);
-    ObjString* interned = tableFindString(&vm.strings, chars, length,
-                                        hash);
-    if (interned != NULL) {
-        FREE_ARRAY(char, chars, length + 1);
-        return interned;
+    // This is where runtime strings are born. Under the lazy policy we skip the hash and the
+    // intern table probe, most of these strings are only printed or passed around anyway.
+    // the chars were allocated by the caller, under its own site. We only charge the object.
+    ENTER_ALLOCATION_SITE("takeString");
+    ObjString* string;
+    if (vm.internPolicy == INTERN_LAZY) {
+        string = allocateLazyString(chars, length);
+    } else {
+        uint32_t hash = hashString(chars, length);
+        string = tableFindString(&vm.strings, chars, length, hash);
+        if (string != NULL) {
+            FREE_ARRAY(char, chars, length + 1);
+        } else {
+            string = allocateString(chars, length, hash);
+        }
+    }
+    LEAVE_ALLOCATION_SITE();
+    return string;
+}
+
+// The elements are left uninitialized: whoever asks for the array fills them before anything can look at it
+// (the kernels in array.h write every element, so zeroing them first would be a whole pass for nothing).
+ObjArray* newArray(int count) {
+    // hosts call this directly, and a negative count would size the object with a huge size_t
+    if (count < 0) return NULL;
+
+    ENTER_ALLOCATION_SITE("array");
+    ObjArray* array = (ObjArray*)allocateObject(arrayBytes(count), OBJ_ARRAY);
+    array->count = count;
+    LEAVE_ALLOCATION_SITE();
+    return array;
+}
+
+ObjArray* copyArray(const double* values, int count) {
+    ObjArray* array = newArray(count);
+    if (array == NULL) return NULL;
+    if (count > 0) memcpy(array->values, values, sizeof(double) * (size_t)count);
+    return array;
+}
+
+// Same length and the same numbers, like == on each pair: [0] == [-0], and an array with a NaN is not equal
+// to anything, not even itself. That's why there is no "same pointer" shortcut here.
+bool arraysEqual(ObjArray* a, ObjArray* b) {
+    if (a->count != b->count) return false;
+    for (int i = 0; i < a->count; i++) {
+        if (a->values[i] != b->values[i]) return false;
     }
-    return allocateString(chars, length, hash);
+    return true;
+}
+
+static void printArray(ObjArray* array) {
+    char buffer[NUMBER_BUFFER_SIZE];
+    writeOutput(vm.output, "[", 1);
+    for (int i = 0; i < array->count; i++) {
+        if (i > 0) writeOutput(vm.output, ", ", 2);
+        int length = formatNumber(array->values[i], buffer);
+        writeOutput(vm.output, buffer, (size_t)length);
+    }
+    writeOutput(vm.output, "]", 1);
 }
 
 void printObject(Value value) {
     switch (OBJ_TYPE(value)) {
         case OBJ_STRING:
-            printf("%s", AS_CSTRING(value));
+            // printing is "looking at the contents", so here is where a rope finally gets flattened
+            writeOutput(vm.output, AS_CSTRING(value), (size_t)AS_STRING(value)->length);
+            break;
+        case OBJ_ARRAY:
+            printArray(AS_ARRAY(value));
             break;
     }
 }
\ No newline at end of file
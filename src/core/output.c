@@ -0,0 +1,205 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+// for fileno and writev
+#define _POSIX_C_SOURCE 200809L
+
+#include "siew/output.h"
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <errno.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define SIEW_HAS_WRITEV
+#endif
+
+// a vectored write takes at most this many slices (plus the sink's own buffer), longer lists are split
+#define OUTPUT_MAX_SLICES 16
+
+static void writeFile(OutputSink* sink, const OutputSlice* slices, int count) {
+#ifdef SIEW_HAS_WRITEV
+    // whatever the host already printed through stdio has to come out before us
+    fflush(sink->file);
+
+    struct iovec vectors[OUTPUT_MAX_SLICES + 1];
+    int vectorCount = 0;
+    for (int i = 0; i < count; i++) {
+        if (slices[i].length == 0) continue;
+        vectors[vectorCount].iov_base = (void*)slices[i].chars;
+        vectors[vectorCount].iov_len = slices[i].length;
+        vectorCount++;
+    }
+
+    // one system call for all of it, unless the OS takes only part of it
+    struct iovec* next = vectors;
+    while (vectorCount > 0) {
+        ssize_t written = writev(fileno(sink->file), next, vectorCount);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return; // nowhere to report it, stdout is gone (closed pipe...)
+        }
+
+        while (vectorCount > 0 && (size_t)written >= next->iov_len) {
+            written -= (ssize_t)next->iov_len;
+            next++;
+            vectorCount--;
+        }
+        if (vectorCount > 0) {
+            next->iov_base = (char*)next->iov_base + written;
+            next->iov_len -= (size_t)written;
+        }
+    }
+#else
+    for (int i = 0; i < count; i++) {
+        fwrite(slices[i].chars, 1, slices[i].length, sink->file);
+    }
+    fflush(sink->file);
+#endif
+}
+
+static void writeCapture(OutputSink* sink, const OutputSlice* slices, int count) {
+    size_t total = 0;
+    for (int i = 0; i < count; i++) total += slices[i].length;
+
+    // + 1 so capturedOutput() can always add the '\0'
+    if (sink->capturedLength + total + 1 > sink->capturedCapacity) {
+        size_t capacity = sink->capturedCapacity < 1024 ? 1024 : sink->capturedCapacity;
+        while (capacity < sink->capturedLength + total + 1) capacity *= 2;
+        char* captured = realloc(sink->captured, capacity);
+        if (captured == NULL) return; // the host asked for the output in memory, and there is no memory for it
+        sink->captured = captured;
+        sink->capturedCapacity = capacity;
+    }
+
+    for (int i = 0; i < count; i++) {
+        memcpy(sink->captured + sink->capturedLength, slices[i].chars, slices[i].length);
+        sink->capturedLength += slices[i].length;
+    }
+}
+
+static void initSink(OutputSink* sink, OutputWriteFn write) {
+    sink->write = write;
+    sink->file = NULL;
+    sink->captured = NULL;
+    sink->capturedLength = 0;
+    sink->capturedCapacity = 0;
+    sink->count = 0;
+}
+
+void initFileSink(OutputSink* sink, FILE* file) {
+    initSink(sink, writeFile);
+    sink->file = file;
+}
+
+void initCaptureSink(OutputSink* sink) {
+    initSink(sink, writeCapture);
+}
+
+void freeOutputSink(OutputSink* sink) {
+    flushOutput(sink);
+    free(sink->captured);
+    initSink(sink, sink->write);
+}
+
+void flushOutput(OutputSink* sink) {
+    if (sink->count == 0) return;
+
+    OutputSlice pending = {sink->buffer, sink->count};
+    sink->count = 0;
+    sink->write(sink, &pending, 1);
+}
+
+void writeOutputv(OutputSink* sink, const OutputSlice* slices, int count) {
+    while (count > OUTPUT_MAX_SLICES) {
+        writeOutputv(sink, slices, OUTPUT_MAX_SLICES);
+        slices += OUTPUT_MAX_SLICES;
+        count -= OUTPUT_MAX_SLICES;
+    }
+
+    size_t total = 0;
+    for (int i = 0; i < count; i++) total += slices[i].length;
+
+    // the common case: small pieces, they are only copied into the buffer
+    if (sink->count + total <= OUTPUT_BUFFER_SIZE) {
+        for (int i = 0; i < count; i++) {
+            memcpy(sink->buffer + sink->count, slices[i].chars, slices[i].length);
+            sink->count += slices[i].length;
+        }
+        return;
+    }
+
+    // They don't fit, but they are small enough that copying them beats an extra write
+    if (total <= OUTPUT_BUFFER_SIZE / 2) {
+        flushOutput(sink);
+        writeOutputv(sink, slices, count);
+        return;
+    }
+
+    // Big pieces (a huge string): no point in copying them. The buffer and the pieces go out together, in order
+    OutputSlice all[OUTPUT_MAX_SLICES + 1];
+    all[0].chars = sink->buffer;
+    all[0].length = sink->count;
+    memcpy(all + 1, slices, sizeof(OutputSlice) * count);
+    sink->count = 0;
+    sink->write(sink, all, count + 1);
+}
+
+void writeOutput(OutputSink* sink, const char* chars, size_t length) {
+    if (sink->count + length <= OUTPUT_BUFFER_SIZE) {
+        memcpy(sink->buffer + sink->count, chars, length);
+        sink->count += length;
+        return;
+    }
+
+    OutputSlice slice = {chars, length};
+    writeOutputv(sink, &slice, 1);
+}
+
+void printOutput(OutputSink* sink, const char* format, ...) {
+    // we format straight into the buffer, and only if it didn't fit we make room and try again
+    size_t space = OUTPUT_BUFFER_SIZE - sink->count;
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(sink->buffer + sink->count, space, format, args);
+    va_end(args);
+
+    if (length < 0) return;
+    if ((size_t)length < space) {
+        sink->count += (size_t)length;
+        return;
+    }
+
+    flushOutput(sink);
+    va_start(args, format);
+    if ((size_t)length < OUTPUT_BUFFER_SIZE) {
+        vsnprintf(sink->buffer, OUTPUT_BUFFER_SIZE, format, args);
+        sink->count = (size_t)length;
+    } else {
+        char* text = malloc((size_t)length + 1);
+        if (text != NULL) {
+            vsnprintf(text, (size_t)length + 1, format, args);
+            writeOutput(sink, text, (size_t)length);
+            free(text);
+        }
+    }
+    va_end(args);
+}
+
+const char* capturedOutput(OutputSink* sink, size_t* length) {
+    flushOutput(sink);
+    if (length != NULL) *length = sink->capturedLength;
+    if (sink->captured == NULL) return "";
+
+    sink->captured[sink->capturedLength] = '\0';
+    return sink->captured;
+}
+
+void resetCapturedOutput(OutputSink* sink) {
+    flushOutput(sink);
+    sink->capturedLength = 0;
+}
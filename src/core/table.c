@@ -16,6 +16,8 @@ void initTable(Table* table) {
     table->count = 0;
     table->capacity = 0;
     table->entries = NULL;
+    table->lookups = 0;
+    table->probes = 0;
 }
 
 void freeTable(Table* table) {
@@ -27,8 +29,10 @@ void freeTable(Table* table) {
 ObjString* tableFindString(Table* table, const char* chars, int length, uint32_t hash) {
     if (table->count == 0) return NULL;
 
+    table->lookups++;
     uint32_t index = hash % table->capacity;
     for (;;) {
+        table->probes++;
         Entry* entry = &table->entries[index];
         if (entry->key == NULL) {
             // Stop if we find an empty non-tombstone entry.
@@ -46,10 +50,12 @@ ObjString* tableFindString(Table* table, const char* chars, int length, uint32_t
     }
 }
 
-static Entry* findEntry(Entry* entries, int capacity, ObjString* key) {
+// probes counts every entry we look at, see Table
+static Entry* findEntry(Entry* entries, int capacity, ObjString* key, uint64_t* probes) {
     uint32_t index = key->hash % capacity;
     Entry* tombstone = NULL;
     for (;;) {
+        (*probes)++;
         Entry* entry = &entries[index];
         if (entry->key == NULL) {
             if (IS_NIL(entry->value)) {
@@ -95,8 +101,10 @@ static Entry* findEntry(Entry* entries, int capacity, ObjString* key) {
 // without prematurely terminating the probe sequence.
 bool tableDelete(Table* table, ObjString* key) {
     if (table->count == 0) return false;
+    key = internString(key);
 
-    Entry* entry = findEntry(table->entries, table->capacity, key);
+    table->lookups++;
+    Entry* entry = findEntry(table->entries, table->capacity, key, &table->probes);
     if (entry->key == NULL) return false;
 
     // we place a tombstone in the entry
@@ -110,12 +118,16 @@ bool tableDelete(Table* table, ObjString* key) {
 static void adjustCapacity(Table* table, int capacity) {
     // we are allocating memory, we are not growing the array, this means that the table->entries will still
     // be there around after this allocation
+    ENTER_ALLOCATION_SITE("table growth");
     Entry* entries = ALLOCATE(Entry, capacity);
+    LEAVE_ALLOCATION_SITE();
 
     // here we create the new buckets for the new array with the new capacity
     // the count may change because we are counting tombstones in the setTable function
     // we don't count the tombstones here, we just ignore them.
     table->count = 0;
+    // re-inserting is not a lookup anybody asked for, those probes don't go to the stats
+    uint64_t rehashProbes = 0;
     for (int i = 0; i < capacity; i++) {
         entries[i].key = NULL;
         entries[i].value = NIL_VAL;
@@ -123,13 +135,13 @@ static void adjustCapacity(Table* table, int capacity) {
 
     // now we need to re-insert the old entries into the new array so they will stay in the place they got before the
     // array got bigger
-    for (int i = 0; i < table->capacity; i) {
+    for (int i = 0; i < table->capacity; i++) {
         Entry* entry = &table->entries[i];
         // if the key is empty, we continue, this means that we are effectively ignoring tombstones, since
         // they have null key
         if (entry->key == NULL) continue;
 
-        Entry* dest = findEntry(entries, capacity, entry->key);
+        Entry* dest = findEntry(entries, capacity, entry->key, &rehashProbes);
         dest->key = entry->key;
         dest->value = entry->value;
         // we just count those values that are not tombstones
@@ -142,6 +154,20 @@ static void adjustCapacity(Table* table, int capacity) {
     table->capacity = capacity;
 }
 
+// The intern table doesn't keep strings alive (it is a "weak" table), otherwise no string would ever be
+// collected. Right before the sweep, we drop every entry whose string was not reached by anybody else.
+void tableRemoveWhite(Table* table) {
+    for (int i = 0; i < table->capacity; i++) {
+        Entry* entry = &table->entries[i];
+        if (entry->key != NULL && !entry->key->obj.isMarked) {
+            // We already have the entry, so the tombstone goes right here. tableDelete() would look the key
+            // up again, and count that lookup in the table's stats on every collection.
+            entry->key = NULL;
+            entry->value = BOOL_VAL(true);
+        }
+    }
+}
+
 void tableAddAll(Table* from, Table* to) {
     for (int i = 0; i < from->capacity; i++) {
         Entry* entry = &from->entries[i];
@@ -153,8 +179,10 @@ void tableAddAll(Table* from, Table* to) {
 
 bool tableGet(Table* table, ObjString* key, Value* value) {
     if (table->count == 0) return false;
+    key = internString(key);
 
-    Entry* entry = findEntry(table->entries, table->capacity, key);
+    table->lookups++;
+    Entry* entry = findEntry(table->entries, table->capacity, key, &table->probes);
     if (entry->key == NULL) return false;
 
     *value = entry->value;
@@ -162,12 +190,18 @@ bool tableGet(Table* table, ObjString* key, Value* value) {
 }
 
 bool tableSet(Table* table, ObjString* key, Value value) {
+    // findEntry compares keys by pointer, and that only works with the canonical instance of a string.
+    // A runtime string (a rope, or anything under INTERN_LAZY) may not be interned yet: being used as
+    // a key is the moment it has to be. For strings that already are interned this is a no-op.
+    key = internString(key);
+
     if (table->count + 1 > table->capacity * TABLE_MAX_LOAD) {
         int capacity = GROW_CAPACITY(table->capacity);
         adjustCapacity(table, capacity);
     }
 
-    Entry* entry = findEntry(table->entries, table->capacity, key);
+    table->lookups++;
+    Entry* entry = findEntry(table->entries, table->capacity, key, &table->probes);
     bool isNewKey = entry->key == NULL;
     // if we had a new key but the value is not empty, that means that we are using a tombstone
     // we don't increment the counter in this case, we just continue.
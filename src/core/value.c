@@ -7,19 +7,24 @@
 #include <string.h>
 
 #include "siew/memory.h"
+#include "siew/number.h"
+#include "siew/vm.h"
 #include "siew/object.h"
 
 void initValueArray(ValueArray* array) {
     array->values = NULL;
     array->capacity = 0;
     array->count = 0;
+    array->arena = NULL;
 }
 
 void writeValueArray(ValueArray* array, Value value) {
     if (array->capacity < array->count + 1) {
         int oldCapacity = array->capacity;
         array->capacity = GROW_CAPACITY(oldCapacity);
-        array->values = GROW_ARRAY(Value, array->values, oldCapacity, array->capacity);
+        ENTER_ALLOCATION_SITE("constants growth");
+        array->values = ARENA_GROW_ARRAY(array->arena, Value, array->values, oldCapacity, array->capacity);
+        LEAVE_ALLOCATION_SITE();
     }
 
     array->values[array->count] = value;
@@ -27,11 +32,14 @@ void writeValueArray(ValueArray* array, Value value) {
 }
 
 void freeValueArray(ValueArray* array) {
-    FREE_ARRAY(Value, array->values, array->capacity);
+    // arena memory is not ours to free, it goes away with the whole arena
+    if (array->arena == NULL) FREE_ARRAY(Value, array->values, array->capacity);
     initValueArray(array);
 }
 
 bool valuesEqual(Value a, Value b) {
+    // an int and a double are the same number when the double is that int
+    if (IS_NUMBER(a) && IS_NUMBER(b)) return AS_NUMBER(a) == AS_NUMBER(b);
     if (a.type != b.type) return false;
 
     // we cannot use the function memcmp() because of the union that we use in the value struct.
@@ -40,9 +48,12 @@ bool valuesEqual(Value a, Value b) {
     switch (a.type) {
         case VAL_BOOL: return AS_BOOL(a) == AS_BOOL(b);
         case VAL_NIL: return true;
-        case VAL_NUMBER: return AS_NUMBER(a) == AS_NUMBER(b);
-            // now that we’ve interned all the strings, we can take advantage of it in the bytecode interpreter
-        case VAL_OBJ: return AS_OBJ(a) == AS_OBJ(b);
+            // interned strings can be compared by pointer, but a rope doesn't know its contents yet (it isn't interned),
+            // so strings go through stringsEqual, which only flattens when the cheap checks can't decide.
+        case VAL_OBJ:
+            if (IS_STRING(a) && IS_STRING(b)) return stringsEqual(AS_STRING(a), AS_STRING(b));
+            if (IS_ARRAY(a) && IS_ARRAY(b)) return arraysEqual(AS_ARRAY(a), AS_ARRAY(b));
+            return AS_OBJ(a) == AS_OBJ(b);
         default: return false; // Unreachable
     }
 }
@@ -50,10 +61,22 @@ bool valuesEqual(Value a, Value b) {
 void printValue(Value value) {
     switch (value.type) {
         case VAL_BOOL:
-            printf(AS_BOOL(value) ? "true" : "false");
+            if (AS_BOOL(value)) writeOutput(vm.output, "true", 4);
+            else writeOutput(vm.output, "false", 5);
             break;
-        case VAL_NIL: printf("nil"); break;
-        case VAL_NUMBER: printf("%g", AS_NUMBER(value)); break;
+        case VAL_NIL: writeOutput(vm.output, "nil", 3); break;
+        case VAL_NUMBER: {
+            char buffer[NUMBER_BUFFER_SIZE];
+            int length = formatNumber(AS_NUMBER(value), buffer);
+            writeOutput(vm.output, buffer, (size_t)length);
+            break;
+        }
+        case VAL_INT: {
+            char buffer[NUMBER_BUFFER_SIZE];
+            int length = formatInteger(AS_INT(value), buffer);
+            writeOutput(vm.output, buffer, (size_t)length);
+            break;
+        }
         case VAL_OBJ: printObject(value); break;
     }
 }
\ No newline at end of file
@@ -7,16 +7,17 @@
 #include <stdio.h>
 
 #include "siew/chunk.h"
+#include "siew/vm.h"
 void disassembleChunk(Chunk* chunk, const char* name) {
-   printf("== %s ==\n", name);
+   printOutput(vm.output, "== %s ==\n", name);
 
    for (int offset = 0; offset < chunk->count;) {
 
       //  we do this because we can have more than one instruction pointing to the same line of code
       if (offset > 0 && chunk->lines[offset] == chunk->lines[offset - 1]) {
-         printf("   | ");
+         printOutput(vm.output, "   | ");
       }else {
-         printf("%4d ", chunk->lines[offset]);
+         printOutput(vm.output, "%4d ", chunk->lines[offset]);
       }
 
       // since instruction can have different sizes, we let
@@ -26,54 +27,107 @@ void disassembleChunk(Chunk* chunk, const char* name) {
 }
 
 static int simpleInstruction(const char* name, int offset) {
-   printf("%s\n", name);
+   printOutput(vm.output, "%s\n", name);
    return offset + 1;
 }
 
 static int constantInstruction(const char* name, Chunk* chunk, int offset) {
    uint8_t constant = chunk->code[offset + 1]; // the value index is in the next byte
-   printf("%-16s %4d '", name, constant);
+   printOutput(vm.output, "%-16s %4d '", name, constant);
    printValue(chunk->constants.values[constant]);
-   printf("'\n");
+   printOutput(vm.output, "'\n");
    return offset + 2; // we offset not only the operation but also the index byte to continue with the next OP
 }
 
+static int smallIntInstruction(const char* name, Chunk* chunk, int offset) {
+   int8_t value = (int8_t)chunk->code[offset + 1];
+   printOutput(vm.output, "%-16s %4d\n", name, value);
+   return offset + 2;
+}
+
+static int intInstruction(const char* name, Chunk* chunk, int offset) {
+   printOutput(vm.output, "%-16s      '", name);
+   printValue(INT_VAL(readInlineInt(chunk->code + offset + 1)));
+   printOutput(vm.output, "'\n");
+   return offset + 1 + (int)sizeof(int32_t);
+}
+
+static int numberInstruction(const char* name, Chunk* chunk, int offset) {
+   printOutput(vm.output, "%-16s      '", name); // no index, the value is in the code, but lined up with OP_CONSTANT's
+   printValue(NUMBER_VAL(readInlineNumber(chunk->code + offset + 1)));
+   printOutput(vm.output, "'\n");
+   return offset + 1 + (int)sizeof(double);
+}
+
+// a frame slot: the constants first (shown as the value), the registers after them
+static void registerOperand(Chunk* chunk, const uint8_t* operand) {
+   int slot = readRegisterOperand(operand);
+   if (slot < chunk->constants.count) {
+      printOutput(vm.output, " '");
+      printValue(chunk->constants.values[slot]);
+      printOutput(vm.output, "'");
+   } else {
+      printOutput(vm.output, " r%d", slot - chunk->constants.count);
+   }
+}
+
+static int registerInstruction(Chunk* chunk, int offset) {
+   uint8_t instruction = chunk->code[offset];
+   const char* name = registerOpName(instruction);
+   if (name == NULL) {
+      printOutput(vm.output, "Unknown opcode %d\n", instruction);
+      return offset + 1;
+   }
+
+   const uint8_t* operand = chunk->code + offset + 1;
+   printOutput(vm.output, "%-16s", name);
+   switch (registerOpForm(instruction)) {
+      case REGISTER_BINARY:
+         registerOperand(chunk, operand);
+         registerOperand(chunk, operand + 2);
+         registerOperand(chunk, operand + 4);
+         break;
+      case REGISTER_UNARY:
+         registerOperand(chunk, operand);
+         registerOperand(chunk, operand + 2);
+         break;
+      case REGISTER_LOAD_NUMBER:
+         registerOperand(chunk, operand);
+         printOutput(vm.output, " '");
+         printValue(NUMBER_VAL(readInlineNumber(operand + 2)));
+         printOutput(vm.output, "'");
+         break;
+      case REGISTER_RETURN:
+         registerOperand(chunk, operand);
+         break;
+   }
+   printOutput(vm.output, "\n");
+   return offset + 1 + registerOperandCount(instruction);
+}
+
 int disassembleInstruction(Chunk* chunk, int offset) {
-   printf("%04d ", offset);
+   printOutput(vm.output, "%04d ", offset);
+   if (chunk->backend == BACKEND_REGISTER) return registerInstruction(chunk, offset);
 
    uint8_t instruction = chunk->code[offset];
+   const char* name = opName(instruction);
+   if (name == NULL) {
+      printOutput(vm.output, "Unknown opcode %d\n", instruction);
+      return offset + 1;
+   }
 
-   switch (instruction) {
-      case OP_RETURN:
-         return simpleInstruction("OP_RETURN", offset);
-      case OP_NEGATE:
-         return simpleInstruction("OP_NEGATE", offset);
-      case OP_CONSTANT:
-         return constantInstruction("OP_CONSTANT", chunk, offset);
-      case OP_NIL:
-         return simpleInstruction("OP_NIL", offset);
-      case OP_TRUE:
-         return simpleInstruction("OP_TRUE", offset);
-      case OP_FALSE:
-         return simpleInstruction("OP_FALSE", offset);
-      case OP_EQUAL:
-         return simpleInstruction("OP_EQUAL", offset);
-      case OP_GREATER:
-         return simpleInstruction("OP_GREATER", offset);
-      case OP_LESS:
-         return simpleInstruction("OP_LESS", offset);
-      case OP_ADD:
-         return simpleInstruction("OP_ADD", offset);
-      case OP_SUBTRACT:
-         return simpleInstruction("OP_SUBTRACT", offset);
-      case OP_MULTIPLY:
-         return simpleInstruction("OP_MULTIPLY", offset);
-      case OP_DIVIDE:
-         return simpleInstruction("OP_DIVIDE", offset);
-      case OP_NOT:
-         return simpleInstruction("OP_NOT", offset);
+   // how an instruction looks only depends on its operand (see opcodes.h)
+   switch (opOperandKind(instruction)) {
+      case OPERAND_CONSTANT:
+         return constantInstruction(name, chunk, offset);
+      case OPERAND_INT8:
+         return smallIntInstruction(name, chunk, offset);
+      case OPERAND_INT32:
+         return intInstruction(name, chunk, offset);
+      case OPERAND_DOUBLE:
+         return numberInstruction(name, chunk, offset);
+      case OPERAND_NONE:
       default:
-         printf("Unknown opcode %d\n", instruction);
-         return offset + 1;
+         return simpleInstruction(name, offset);
    }
 }
\ No newline at end of file
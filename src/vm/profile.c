@@ -0,0 +1,119 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include "siew/profile.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef DEBUG_PROFILE_OPCODES
+
+OpcodeProfile opcodeProfile;
+
+#define TOP_PAIRS 20
+
+typedef struct {
+    int first;
+    int second;
+    uint64_t count;
+} PairCount;
+
+static int compareOpcodes(const void* a, const void* b) {
+    uint64_t x = opcodeProfile.executed[*(const int*)a];
+    uint64_t y = opcodeProfile.executed[*(const int*)b];
+    return (x < y) - (x > y);
+}
+
+static int comparePairs(const void* a, const void* b) {
+    uint64_t x = ((const PairCount*)a)->count;
+    uint64_t y = ((const PairCount*)b)->count;
+    return (x < y) - (x > y);
+}
+
+static double percent(uint64_t count, uint64_t total) {
+    return total == 0 ? 0 : (double)count * 100 / (double)total;
+}
+
+void writeOpcodeProfile(FILE* file, bool json) {
+    int order[OP_COUNT];
+    uint64_t total = 0;
+    for (int i = 0; i < OP_COUNT; i++) {
+        order[i] = i;
+        total += opcodeProfile.executed[i];
+    }
+    qsort(order, OP_COUNT, sizeof(int), compareOpcodes);
+
+    PairCount pairs[OP_COUNT * OP_COUNT];
+    int pairCount = 0;
+    uint64_t pairTotal = 0;
+    for (int first = 0; first < OP_COUNT; first++) {
+        for (int second = 0; second < OP_COUNT; second++) {
+            uint64_t count = opcodeProfile.pairs[first][second];
+            if (count == 0) continue;
+            pairs[pairCount++] = (PairCount){first, second, count};
+            pairTotal += count;
+        }
+    }
+    qsort(pairs, (size_t)pairCount, sizeof(PairCount), comparePairs);
+
+    if (json) {
+        fprintf(file, "{\n  \"instructions\": %llu,\n  \"add_strings\": %llu,\n  \"opcodes\": [\n",
+            (unsigned long long)total, (unsigned long long)opcodeProfile.addStrings);
+        bool first = true;
+        for (int i = 0; i < OP_COUNT; i++) {
+            int op = order[i];
+            if (opcodeProfile.executed[op] == 0 && opcodeProfile.typeErrors[op] == 0) continue;
+            fprintf(file, "%s    {\"name\": \"%s\", \"count\": %llu, \"type_errors\": %llu}", first ? "" : ",\n",
+                opName((uint8_t)op), (unsigned long long)opcodeProfile.executed[op],
+                (unsigned long long)opcodeProfile.typeErrors[op]);
+            first = false;
+        }
+        // every pair, the table only shows the top ones
+        fprintf(file, "\n  ],\n  \"pairs\": [\n");
+        for (int i = 0; i < pairCount; i++) {
+            fprintf(file, "    {\"first\": \"%s\", \"second\": \"%s\", \"count\": %llu}%s\n",
+                opName((uint8_t)pairs[i].first), opName((uint8_t)pairs[i].second),
+                (unsigned long long)pairs[i].count, i + 1 < pairCount ? "," : "");
+        }
+        fprintf(file, "  ]\n}\n");
+        return;
+    }
+
+    fprintf(file, "== opcodes: %llu executed ==\n", (unsigned long long)total);
+    fprintf(file, "%-16s %14s %7s %12s\n", "opcode", "count", "%", "type errors");
+    for (int i = 0; i < OP_COUNT; i++) {
+        int op = order[i];
+        if (opcodeProfile.executed[op] == 0 && opcodeProfile.typeErrors[op] == 0) continue;
+        fprintf(file, "%-16s %14llu %6.2f%% %12llu\n", opName((uint8_t)op),
+            (unsigned long long)opcodeProfile.executed[op], percent(opcodeProfile.executed[op], total),
+            (unsigned long long)opcodeProfile.typeErrors[op]);
+    }
+    if (opcodeProfile.executed[OP_ADD] > 0) {
+        fprintf(file, "OP_ADD: %.2f%% concatenated strings\n",
+            percent(opcodeProfile.addStrings, opcodeProfile.executed[OP_ADD]));
+    }
+
+    fprintf(file, "== pairs: top %d of %d ==\n", pairCount < TOP_PAIRS ? pairCount : TOP_PAIRS, pairCount);
+    for (int i = 0; i < pairCount && i < TOP_PAIRS; i++) {
+        fprintf(file, "%-16s %-16s %14llu %6.2f%%\n", opName((uint8_t)pairs[i].first), opName((uint8_t)pairs[i].second),
+            (unsigned long long)pairs[i].count, percent(pairs[i].count, pairTotal));
+    }
+}
+
+void resetOpcodeProfile() {
+    memset(&opcodeProfile, 0, sizeof(opcodeProfile));
+    opcodeProfile.previous = OP_COUNT;
+}
+
+#else
+
+void writeOpcodeProfile(FILE* file, bool json) {
+    (void)file;
+    (void)json;
+}
+
+void resetOpcodeProfile() {
+}
+
+#endif
@@ -0,0 +1,170 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+// for sigaction and setitimer
+#define _XOPEN_SOURCE 700
+
+#include "siew/sampler.h"
+
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "siew/chunk.h"
+#include "siew/vm.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/time.h>
+#define SIEW_HAS_SAMPLER
+#endif
+
+#define SAMPLE_SLOTS 8192 // distinct (line, opcode) pairs we can keep apart, must be a power of 2
+#define MAX_PROBES 64 // the handler gives up after this many taken slots, and counts the sample as dropped
+
+typedef struct {
+    int line; // 0 is an empty slot, lines start at 1
+    int opcode;
+    uint64_t count;
+} SampleSlot;
+
+// Everything the signal handler touches is static, it can't call malloc
+static SampleSlot slots[SAMPLE_SLOTS];
+static uint64_t compileSamples;
+static uint64_t hostSamples;
+static uint64_t droppedSamples;
+static volatile sig_atomic_t compiling;
+static bool sampling;
+
+static void recordSample(int line, int opcode) {
+    uint32_t hash = ((uint32_t)line * 31u + (uint32_t)opcode) * 2654435761u;
+    for (int probe = 0; probe < MAX_PROBES; probe++) {
+        SampleSlot* slot = &slots[(hash + (uint32_t)probe) & (SAMPLE_SLOTS - 1)];
+        if (slot->line == line && slot->opcode == opcode) {
+            slot->count++;
+            return;
+        }
+        if (slot->line == 0) {
+            slot->line = line;
+            slot->opcode = opcode;
+            slot->count = 1;
+            return;
+        }
+    }
+    droppedSamples++;
+}
+
+void markCompiling(bool value) {
+    compiling = value;
+}
+
+#ifdef SIEW_HAS_SAMPLER
+
+// The signal can land anywhere, even between two stores of interpretChunk(), so we only believe ip
+// when it is inside the chunk. The loops leave ip right after the opcode they are running (see runCachedSampled()).
+// Both are read through volatile, the same way the VM publishes them (see VM_PUBLISH_IP()).
+static void onSample(int signal) {
+    (void)signal;
+    Chunk* chunk = *(Chunk* volatile*)&vm.chunk;
+    uint8_t* ip = *(uint8_t* volatile*)&vm.ip;
+
+    if (chunk != NULL && ip > chunk->code && ip <= chunk->code + chunk->count) {
+        int offset = (int)(ip - chunk->code - 1);
+        recordSample(chunk->lines[offset], chunk->code[offset]);
+    } else if (compiling) {
+        compileSamples++;
+    } else {
+        hostSamples++;
+    }
+}
+
+bool startSampling(int hz) {
+    if (sampling || hz <= 0) return false;
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = onSample;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART; // the reads of a streamed script shouldn't fail with EINTR because of us
+    if (sigaction(SIGPROF, &action, NULL) != 0) return false;
+
+    // ITIMER_PROF counts the CPU time of the process: a script waiting on a pipe is not sampled
+    long period = 1000000L / hz;
+    if (period == 0) period = 1;
+    struct itimerval timer;
+    timer.it_interval.tv_sec = period / 1000000L;
+    timer.it_interval.tv_usec = period % 1000000L;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, NULL) != 0) return false;
+
+    sampling = true;
+    vm.sampling = true;
+    return true;
+}
+
+void stopSampling() {
+    if (!sampling) return;
+
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+    // a signal already on its way would kill the process with the default action
+    signal(SIGPROF, SIG_IGN);
+
+    sampling = false;
+    vm.sampling = false;
+}
+
+#else
+
+bool startSampling(int hz) {
+    (void)hz;
+    return false;
+}
+
+void stopSampling() {
+}
+
+#endif
+
+static int compareSlots(const void* a, const void* b) {
+    const SampleSlot* x = a;
+    const SampleSlot* y = b;
+    if (x->line != y->line) return x->line - y->line;
+    return x->opcode - y->opcode;
+}
+
+// ";" separates frames and the last " " starts the count, some tools split on any space, so neither goes in a name
+static void writeFrameName(FILE* file, const char* name) {
+    for (const char* c = name; *c != '\0'; c++) fputc(*c == ';' || *c == ' ' ? '_' : *c, file);
+}
+
+static void writeOther(FILE* file, const char* scriptName, const char* frame, uint64_t count) {
+    if (count == 0) return;
+    writeFrameName(file, scriptName);
+    fprintf(file, ";%s %llu\n", frame, (unsigned long long)count);
+}
+
+void writeFoldedSamples(FILE* file, const char* scriptName) {
+    // sorted by line, so the file reads like the script
+    SampleSlot* sorted = malloc(sizeof(slots));
+    int count = 0;
+    if (sorted != NULL) {
+        for (int i = 0; i < SAMPLE_SLOTS; i++) {
+            if (slots[i].line != 0) sorted[count++] = slots[i];
+        }
+        qsort(sorted, (size_t)count, sizeof(SampleSlot), compareSlots);
+    }
+
+    for (int i = 0; i < count; i++) {
+        const char* name = opName((uint8_t)sorted[i].opcode);
+        writeFrameName(file, scriptName);
+        fprintf(file, ";line:%d;%s %llu\n", sorted[i].line, name != NULL ? name : "?",
+            (unsigned long long)sorted[i].count);
+    }
+    free(sorted);
+
+    writeOther(file, scriptName, "(compile)", compileSamples);
+    writeOther(file, scriptName, "(outside_bytecode)", hostSamples);
+    writeOther(file, scriptName, "(dropped)", droppedSamples);
+}
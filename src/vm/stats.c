@@ -0,0 +1,76 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include "siew/stats.h"
+
+#include <string.h>
+
+#include "siew/vm.h"
+
+static const char* objTypeNames[OBJ_TYPE_COUNT] = {
+    [OBJ_STRING] = "string",
+    [OBJ_ARRAY] = "array",
+};
+
+void snapshotStats(StatsSnapshot* snapshot) {
+    snapshot->counters = vm.stats;
+    snapshot->liveBytes = vm.bytesAllocated;
+
+    // the table's count has the tombstones in, telling them apart means walking it
+    int live = 0;
+    int tombstones = 0;
+    for (int i = 0; i < vm.strings.capacity; i++) {
+        Entry* entry = &vm.strings.entries[i];
+        if (entry->key != NULL) {
+            live++;
+        } else if (!IS_NIL(entry->value)) {
+            tombstones++;
+        }
+    }
+    snapshot->internCount = live;
+    snapshot->internTombstones = tombstones;
+    snapshot->internCapacity = vm.strings.capacity;
+    snapshot->internLoadFactor = vm.strings.capacity == 0 ? 0 : (double)vm.strings.count / vm.strings.capacity;
+    snapshot->internLookups = vm.strings.lookups;
+    snapshot->internAverageProbe = vm.strings.lookups == 0 ? 0 : (double)vm.strings.probes / (double)vm.strings.lookups;
+}
+
+void resetStats() {
+    uint64_t liveObjects[OBJ_TYPE_COUNT];
+    memcpy(liveObjects, vm.stats.liveObjects, sizeof(liveObjects));
+    memset(&vm.stats, 0, sizeof(vm.stats));
+    memcpy(vm.stats.liveObjects, liveObjects, sizeof(liveObjects));
+    vm.stats.peakBytes = vm.bytesAllocated;
+
+    vm.strings.lookups = 0;
+    vm.strings.probes = 0;
+}
+
+void writeStatsJson(FILE* file, const StatsSnapshot* snapshot) {
+    const VMStats* counters = &snapshot->counters;
+    fprintf(file, "{\n  \"instructions\": %llu,\n", (unsigned long long)counters->instructions);
+
+    fprintf(file, "  \"memory\": {\"live_bytes\": %llu, \"peak_bytes\": %llu, \"allocations\": %llu, "
+        "\"allocated_bytes\": %llu, \"freed_bytes\": %llu, \"collections\": %llu},\n",
+        (unsigned long long)snapshot->liveBytes, (unsigned long long)counters->peakBytes,
+        (unsigned long long)counters->allocations, (unsigned long long)counters->allocatedBytes,
+        (unsigned long long)counters->freedBytes, (unsigned long long)counters->collections);
+
+    fprintf(file, "  \"live_objects\": {");
+    for (int type = 0; type < OBJ_TYPE_COUNT; type++) {
+        fprintf(file, "%s\"%s\": %llu", type == 0 ? "" : ", ", objTypeNames[type],
+            (unsigned long long)counters->liveObjects[type]);
+    }
+    fprintf(file, "},\n");
+
+    fprintf(file, "  \"intern_table\": {\"count\": %d, \"tombstones\": %d, \"capacity\": %d, \"load_factor\": %.4f, "
+        "\"lookups\": %llu, \"average_probe\": %.4f},\n", snapshot->internCount, snapshot->internTombstones,
+        snapshot->internCapacity, snapshot->internLoadFactor, (unsigned long long)snapshot->internLookups,
+        snapshot->internAverageProbe);
+
+    fprintf(file, "  \"chunks\": {\"count\": %llu, \"code_bytes\": %llu, \"max_code_bytes\": %llu, "
+        "\"constants\": %llu, \"max_constants\": %llu}\n}\n", (unsigned long long)counters->chunks,
+        (unsigned long long)counters->codeBytes, (unsigned long long)counters->maxCodeBytes,
+        (unsigned long long)counters->constants, (unsigned long long)counters->maxConstants);
+}
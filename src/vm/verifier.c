@@ -0,0 +1,117 @@
+//
+// Created by augus on 10/18/2026.
+//
+
+#include "siew/verifier.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// an operand is two bytes, no instruction can name a slot past this. A bigger frame would only be nil-filled
+#define REGISTER_FRAME_MAX (UINT16_MAX + 1)
+
+static bool fail(VerifyError* error, int offset, const char* message) {
+    if (error != NULL) {
+        error->offset = offset;
+        error->message = message;
+    }
+    return false;
+}
+
+// Register code reads its operands from the frame instead of the stack, so what can go wrong is different:
+// an operand past the frame, a write into the constants, or reading a register nothing wrote yet
+// (runRegisters() starts them as nil, but our compiler never does it, so it's a sign of broken code).
+static bool verifyRegisters(Chunk* chunk, VerifyError* error) {
+    int constants = chunk->constants.count;
+    if (chunk->maxStack < constants) return fail(error, 0, "Frame smaller than the constants.");
+    if (chunk->maxStack > REGISTER_FRAME_MAX) return fail(error, 0, "Frame larger than the operands can reach.");
+
+    // host memory, like the stack: the verifier can't trigger a collection
+    bool* written = calloc((size_t)chunk->maxStack + 1, sizeof(bool));
+    if (written == NULL) return fail(error, 0, "Out of memory.");
+    for (int slot = 0; slot < constants; slot++) written[slot] = true;
+
+    bool valid = false;
+    int offset = 0;
+    while (offset < chunk->count) {
+        uint8_t instruction = chunk->code[offset];
+        if (instruction >= REGISTER_OP_COUNT) {
+            fail(error, offset, "Unknown opcode.");
+            break;
+        }
+        int operands = registerOperandCount(instruction);
+        if (offset + operands >= chunk->count) {
+            fail(error, offset, "Operand past the end of the code.");
+            break;
+        }
+
+        RegisterForm form = registerOpForm(instruction);
+        const uint8_t* operand = &chunk->code[offset + 1];
+        int first = form == REGISTER_RETURN ? 0 : 1; // the first source, after dst
+        int sources = form == REGISTER_BINARY ? 2 : form == REGISTER_LOAD_NUMBER ? 0 : 1;
+
+        bool ok = true;
+        for (int i = first; i < first + sources && ok; i++) {
+            int slot = readRegisterOperand(operand + 2 * i);
+            if (slot >= chunk->maxStack) ok = fail(error, offset, "Operand outside the frame.");
+            else if (!written[slot]) ok = fail(error, offset, "Register read before it is written.");
+        }
+        if (ok && form != REGISTER_RETURN) {
+            int dst = readRegisterOperand(operand);
+            if (dst >= chunk->maxStack) ok = fail(error, offset, "Operand outside the frame.");
+            else if (dst < constants) ok = fail(error, offset, "Instruction writes a constant.");
+            else written[dst] = true;
+        }
+        if (!ok) break;
+
+        if (instruction == R_RETURN) {
+            chunk->verified = true;
+            valid = true;
+            break;
+        }
+        offset += 1 + operands;
+    }
+    if (!valid && offset >= chunk->count) fail(error, offset, "Code runs past the end without R_RETURN.");
+
+    free(written);
+    return valid;
+}
+
+bool verifyChunk(Chunk* chunk, VerifyError* error) {
+    if (chunk->count == 0) return fail(error, 0, "Empty chunk.");
+    if (chunk->maxStack < 0) return fail(error, 0, "Negative stack size.");
+    if (chunk->backend == BACKEND_REGISTER) return verifyRegisters(chunk, error);
+
+    // There are no jumps yet, so the code runs straight from the first byte to the first OP_RETURN,
+    // and the stack depth at every instruction is known without looking at any other path.
+    // maxStack is only an upper bound the caller claims, the deepest we really get is what interpretChunk() reserves.
+    int depth = 0;
+    int deepest = 0;
+    int offset = 0;
+    while (offset < chunk->count) {
+        uint8_t instruction = chunk->code[offset];
+        if (instruction >= OP_COUNT) return fail(error, offset, "Unknown opcode.");
+
+        int operands = opOperandCount(instruction);
+        if (offset + operands >= chunk->count) return fail(error, offset, "Operand past the end of the code.");
+
+        if (opOperandKind(instruction) == OPERAND_CONSTANT && chunk->code[offset + 1] >= chunk->constants.count) {
+            return fail(error, offset, "Constant index out of range.");
+        }
+
+        if (depth < opStackInputs(instruction)) return fail(error, offset, "Stack underflow.");
+        depth += opStackEffect(instruction);
+        if (depth > chunk->maxStack) return fail(error, offset, "Stack deeper than the chunk's maxStack.");
+        if (depth > deepest) deepest = depth;
+
+        // what comes after is never executed (and never looked at again)
+        if (instruction == OP_RETURN) {
+            chunk->maxStack = deepest;
+            chunk->verified = true;
+            return true;
+        }
+        offset += 1 + operands;
+    }
+
+    return fail(error, offset, "Code runs past the end without OP_RETURN.");
+}
@@ -4,22 +4,33 @@
 
 #include "siew/vm.h"
 
+#include <limits.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include "siew/array.h"
 #include "siew/debug.h"
 #include "siew/compiler.h"
 #include "siew/memory.h"
 #include "siew/object.h"
+#include "siew/profile.h"
+#include "siew/sampler.h"
+#include "siew/verifier.h"
 
 VM vm; // this is NOT a good idea. Thread safe left the room
 
+static OutputSink standardOutput;
+
 static void resetStack() {
     vm.stackTop = vm.stack;
 };
 
 static void runtimeError(const char* format, ...) {
+    // what the program printed so far comes before the error
+    flushOutput(vm.output);
+
     va_list args;
     va_start(args, format);
     vfprintf(stderr, format, args);
@@ -32,15 +43,110 @@ static void runtimeError(const char* format, ...) {
     resetStack();
 }
 
+// maxStack only counts what the code pushes. While it runs, a few helpers also push a value for a moment, so the GC
+// sees an object nobody points at yet (allocateString(), internString(), addConstant()). Each one pops it before
+// returning and none of them calls another while it holds its slot, so one slot over maxStack is all they need.
+#define STACK_SLACK 1
+
+// Makes room for at least slots values on the stack. Only called between runs, never in the middle of one.
+// The sizing is done in size_t, a chunk can ask for a lot and doubling an int would wrap. Returns false (and
+// leaves the stack as it was) if it can't be that big: more than an int counts, more than size_t can address,
+// or more than malloc gives us.
+static bool reserveStack(size_t slots) {
+    if (slots <= (size_t)vm.stackCapacity) return true;
+
+    size_t limit = (size_t)INT_MAX; // vm.stackCapacity is an int
+    if (limit > SIZE_MAX / sizeof(Value) - 1) limit = SIZE_MAX / sizeof(Value) - 1; // and the spare slot
+    if (slots > limit) return false;
+
+    size_t used = (size_t)(vm.stackTop - vm.stack);
+    size_t capacity = vm.stackCapacity < STACK_MIN ? STACK_MIN : (size_t)vm.stackCapacity;
+    while (capacity < slots) capacity = capacity > limit / 2 ? limit : capacity * 2;
+
+    // like the gray stack, this is the VM's own memory: it doesn't go through reallocate() (and can't trigger a GC)
+    // There is one spare slot below the bottom, runCached() writes its cached top there when the stack is empty.
+    Value* allocation = vm.stack != NULL ? vm.stack - 1 : NULL;
+    allocation = (Value*)realloc(allocation, sizeof(Value) * (capacity + 1));
+    if (allocation == NULL) return false;
+    allocation[0] = NIL_VAL;
+    vm.stack = allocation + 1;
+    vm.stackTop = vm.stack + used;
+    vm.stackCapacity = (int)capacity;
+    return true;
+}
+
 void initVM() {
+    vm.stack = NULL;
+    vm.stackTop = NULL;
+    vm.stackCapacity = 0;
+    if (!reserveStack(STACK_MIN)) exit(1);
     resetStack();
     vm.objects = NULL;
+    vm.bytesAllocated = 0;
+    vm.heapLimit = 0;
+    vm.outOfMemoryJump = NULL;
+    vm.grayCount = 0;
+    vm.grayCapacity = 0;
+    vm.grayStack = NULL;
+    vm.chunk = NULL;
+    vm.internPolicy = INTERN_EAGER;
+    vm.cacheRegisters = true;
+    vm.backend = BACKEND_STACK;
+    memset(&vm.stats, 0, sizeof(vm.stats));
+    initFileSink(&standardOutput, stdout);
+    vm.output = &standardOutput;
     initTable(&vm.strings);
+    initArena(&vm.compileArena);
 }
 
+#ifdef DEBUG_PROFILE_OPCODES
+// the profile outlives interpret() calls, a host that runs many scripts gets the counts of all of them
+static void dumpOpcodeProfile() {
+    uint64_t executed = 0;
+    for (int i = 0; i < OP_COUNT; i++) executed += opcodeProfile.executed[i];
+    if (executed == 0) return;
+
+    const char* path = getenv("SIEW_OPCODE_PROFILE");
+    FILE* file = path != NULL ? fopen(path, "w") : NULL;
+    if (file != NULL) {
+        writeOpcodeProfile(file, true);
+        fclose(file);
+    } else {
+        writeOpcodeProfile(stderr, false);
+    }
+    resetOpcodeProfile();
+}
+#endif
+
 void freeVM() {
+    flushOutput(vm.output);
+#ifdef DEBUG_PROFILE_OPCODES
+    dumpOpcodeProfile();
+#endif
     freeTable(&vm.strings);
+    freeArena(&vm.compileArena);
     freeObjects();
+    free(vm.grayStack);
+    if (vm.stack != NULL) free(vm.stack - 1);
+    vm.stack = NULL;
+    vm.stackCapacity = 0;
+}
+
+// Both loops run the same bytecode the same way, this only picks how (see runCached())
+void setRegisterCaching(bool enabled) {
+    vm.cacheRegisters = enabled;
+}
+
+// What interpret() compiles the source to from now on. A chunk compiled by the host runs with its own backend.
+// The sampling profiler only knows the stack loops, so while sampling interpret() compiles for the stack anyway.
+void setBackend(Backend backend) {
+    vm.backend = backend;
+}
+
+// NULL goes back to stdout. Whatever the old sink still had buffered is flushed first
+void setOutputSink(OutputSink* sink) {
+    flushOutput(vm.output);
+    vm.output = sink != NULL ? sink : &standardOutput;
 }
 
 void push(Value value) {
@@ -71,54 +177,108 @@ static bool isFalsey(Value value) {
     return IS_NIL(value) || (IS_BOOL(value) && !AS_BOOL(value));
 }
 
-static void concatenate() {
-    /* Memory management at its peak.
+// one compare and one branch for both types, instead of a branch each
+#define BOTH_INTS(a, b) ((((a).type ^ VAL_INT) | ((b).type ^ VAL_INT)) == 0)
+
+// Arithmetic on two ints (see INT_VAL). While the result fits in an int it is an int, when it overflows it is
+// the double the old code computed: the operands are exact as doubles, so the double operation rounds
+// the exact result just like it always did.
+static inline Value addInts(int32_t a, int32_t b) {
+    int32_t sum;
+    if (SIEW_ADD_OVERFLOW(a, b, &sum)) return NUMBER_VAL((double)a + (double)b);
+    return INT_VAL(sum);
+}
+
+static inline Value subtractInts(int32_t a, int32_t b) {
+    int32_t difference;
+    if (SIEW_SUB_OVERFLOW(a, b, &difference)) return NUMBER_VAL((double)a - (double)b);
+    return INT_VAL(difference);
+}
+
+static inline Value multiplyInts(int32_t a, int32_t b) {
+    int32_t product;
+    if (SIEW_MUL_OVERFLOW(a, b, &product)) return NUMBER_VAL((double)a * (double)b);
+    // as doubles 0 * -5 is -0 (and prints "-0"), an int has no -0
+    if (product == 0 && (a | b) < 0) return NUMBER_VAL(-0.0);
+    return INT_VAL(product);
+}
+
+// division always makes a double, 7 / 2 is 3.5
+static inline Value divideInts(int32_t a, int32_t b) {
+    return NUMBER_VAL((double)a / (double)b);
+}
+
+static inline Value negateInt(int32_t a) {
+    // -0, and -INT32_MIN doesn't fit
+    if (a == 0 || a == INT32_MIN) return NUMBER_VAL(-(double)a);
+    return INT_VAL(-a);
+}
+
+static inline Value greaterInts(int32_t a, int32_t b) {
+    return BOOL_VAL(a > b);
+}
+
+static inline Value lessInts(int32_t a, int32_t b) {
+    return BOOL_VAL(a < b);
+}
+
+// Two arrays through an arithmetic operator or a comparison: a single kernel call does every element (see array.h),
+// < and > give masks. op is the stack opcode, the register loop passes the one its instruction stands for.
+// a and b have to stay reachable until the result is somewhere the GC looks (on the stack or in their registers),
+// allocating it can trigger a collection. Returns false after reporting the error.
+static bool arrayOperation(OpCode op, Value a, Value b, Value* result) {
+    ObjArray* left = AS_ARRAY(a);
+    ObjArray* right = AS_ARRAY(b);
+    if (left->count != right->count) {
+        runtimeError("Arrays must have the same length (%d and %d).", left->count, right->count);
+        return false;
+    }
+
+    ObjArray* array = newArray(left->count);
+    switch (op) {
+        case OP_ADD:      arrayAdd(array->values, left->values, right->values, left->count); break;
+        case OP_SUBTRACT: arraySubtract(array->values, left->values, right->values, left->count); break;
+        case OP_MULTIPLY: arrayMultiply(array->values, left->values, right->values, left->count); break;
+        case OP_DIVIDE:   arrayDivide(array->values, left->values, right->values, left->count); break;
+        case OP_LESS:     arrayLessMask(array->values, left->values, right->values, left->count); break;
+        case OP_GREATER:  arrayGreaterMask(array->values, left->values, right->values, left->count); break;
+        default: SIEW_UNREACHABLE();
+    }
+    *result = OBJ_VAL(array);
+    return true;
+}
+
+// Returns false after reporting the error, when the result would be longer than a string can be.
+static bool concatenate() {
+    /* Memory management at its peak... or at least it used to be.
      * Suppose we have:
      *   a = "hello ";
      *   b = "world";
      *
-     * What we’re doing here is allocating a new chunk of memory large enough to
-     * hold both strings together (length(a) + length(b)).
+     * We used to allocate a new block big enough for both strings, copy `a`, copy `b`,
+     * hash the result and look it up in the intern table. Every single '+'.
+     * Building a string piece by piece that way copies (and hashes) everything built so far
+     * again and again: quadratic. Not sick.
      *
-     * At first, that new memory block is empty. We copy the bytes of `a` into it:
-     *   hello _ _ _ _ _ _
-     *
-     * Then we move the pointer to the end of `a` (the space in this case) and start
-     * copying the bytes of `b`, producing:
-     *   hello world_
-     *
-     * The final byte we write is always the null terminator. Even though our
-     * ObjString tracks length explicitly and doesn’t technically need it, spending
-     * this single byte keeps our strings compatible with the C std library.
-     *
-     * Sick.
+     * Now the result is a rope: a tiny node that just says "a followed by b". That's O(1).
+     * The copy, the hash and the interning happen once, when someone actually looks at the
+     * contents (printing it, comparing it, using it as a key). See flattenString in object.c.
      */
-    ObjString* b = AS_STRING(pop());
-    ObjString* a = AS_STRING(pop());
-
-    int length = a->length + b->length;
-
-    char* chars = ALLOCATE(char, length+ 1);
-
-    memcpy(chars, a->chars, a->length);
-    memcpy(chars + a->length, b->chars, b->length);
-
-    chars[length] = '\0';
-
-    // We use takeString instead of copyString because this concatenation isn’t a
-    // string literal baked into the source code. This char array is something we
-    // built dynamically, and it already lives on the heap.
-    //
-    // That means the resulting SIEW string object can safely take ownership of
-    // this memory. If we used copyString here, not only would it be redundant, but
-    // this function would also become responsible for freeing the temporary buffer
-    // we just allocated. Totally unnecessary.
-    //
-    // Instead, we simply hand over the freshly concatenated buffer to the object.
-    // takeString claims ownership of the chars we pass to it.
-    // Very important detail to remember.
-    ObjString* result = takeString(chars, length);
+    // we peek instead of pop, allocating the rope can trigger a collection and the operands must stay reachable
+    ObjString* b = AS_STRING(peek(0));
+    ObjString* a = AS_STRING(peek(1));
+
+    ENTER_ALLOCATION_SITE("concatenate");
+    ObjString* result = concatenateStrings(a, b);
+    LEAVE_ALLOCATION_SITE();
+    if (result == NULL) {
+        runtimeError("String too long.");
+        return false;
+    }
+    pop();
+    pop();
     push(OBJ_VAL(result));
+    return true;
 }
 
 static InterpretResult run() {
@@ -131,9 +291,25 @@ static InterpretResult run() {
 // the left (operant) will be before the right in the stack... duh...
 // that means that we must first pop() the right to access the left in the stack... duh x2.
 // And in that way we can evaluate our expression the way we agreed (left to right).
-#define BINARY_OP(valueType, op) \
+// Two ints have their own path (intOp), and give an int when they can.
+#define BINARY_OP(valueType, op, intOp) \
     do { \
+        if (BOTH_INTS(peek(0), peek(1))) { \
+            int32_t b = AS_INT(pop()); \
+            int32_t a = AS_INT(pop()); \
+            push(intOp(a, b)); \
+            break; \
+        } \
         if (!IS_NUMBER(peek(0)) || !IS_NUMBER(peek(1))) { \
+            if (IS_ARRAY(peek(0)) && IS_ARRAY(peek(1))) { \
+                Value result; \
+                if (!arrayOperation(instruction, peek(1), peek(0), &result)) return INTERPRET_RUNTIME_ERROR; \
+                pop(); \
+                pop(); \
+                push(result); \
+                break; \
+            } \
+            PROFILE_TYPE_ERROR(instruction); \
             runtimeError("Operands must be numbers."); \
             return INTERPRET_RUNTIME_ERROR; \
         } \
@@ -143,45 +319,61 @@ static InterpretResult run() {
     } while (false) // This 'do while' is a trick to expand this block of code in almost everywhere, also allowing
     // places with a ';' at the end
 
-
+    PROFILE_START();
     for (;;) {
 #ifdef DEBUG_TRACE_EXECUTION
-        printf("          ");
+        printOutput(vm.output, "          ");
         for (Value* slot = vm.stack; slot < vm.stackTop; slot++)
         {
-            printf("[ ");
+            printOutput(vm.output, "[ ");
             printValue(*slot);
-            printf(" ]");
+            printOutput(vm.output, " ]");
         }
-        printf("\n");
+        printOutput(vm.output, "\n");
         disassembleInstruction(vm.chunk, (int) (vm.ip - vm.chunk->code));
 #endif
 
-        uint8_t instruction;
-        switch (instruction = READ_BYTE()) {
+        uint8_t instruction = READ_BYTE();
+        vm.stats.instructions++;
+        PROFILE_INSTRUCTION(instruction);
+        switch (instruction) {
             case OP_RETURN: {
-                printValue(pop());
-                printf("\n");
+                // printing may flatten a rope (allocating), so the value stays on the stack until we are done
+                printValue(peek(0));
+                writeOutput(vm.output, "\n", 1);
+                pop();
                 return INTERPRET_OK;
             }
             case OP_ADD: {
                 // TODO: do that a number and a string can be concatenated
-                if (IS_STRING(peek(0)) && IS_STRING(peek(1))) {
-                    concatenate();
+                if (BOTH_INTS(peek(0), peek(1))) {
+                    int32_t b = AS_INT(pop());
+                    int32_t a = AS_INT(pop());
+                    push(addInts(a, b));
+                }else if (IS_STRING(peek(0)) && IS_STRING(peek(1))) {
+                    PROFILE_ADD_STRINGS();
+                    if (!concatenate()) return INTERPRET_RUNTIME_ERROR;
                 }else if (IS_NUMBER(peek(0)) && IS_NUMBER(peek(1))) {
                     double b = AS_NUMBER(pop());
                     double a = AS_NUMBER(pop());
                     push(NUMBER_VAL(a + b));
+                }else if (IS_ARRAY(peek(0)) && IS_ARRAY(peek(1))) {
+                    Value result;
+                    if (!arrayOperation(OP_ADD, peek(1), peek(0), &result)) return INTERPRET_RUNTIME_ERROR;
+                    pop();
+                    pop();
+                    push(result);
                 }else {
+                    PROFILE_TYPE_ERROR(OP_ADD);
                     runtimeError(
                         "Operands must be numbers or strings.");
                     return INTERPRET_RUNTIME_ERROR;
                 }
                 break;
             }
-            case OP_SUBTRACT: BINARY_OP(NUMBER_VAL, -); break;
-            case OP_MULTIPLY: BINARY_OP(NUMBER_VAL, *); break;
-            case OP_DIVIDE:   BINARY_OP(NUMBER_VAL, /); break;
+            case OP_SUBTRACT: BINARY_OP(NUMBER_VAL, -, subtractInts); break;
+            case OP_MULTIPLY: BINARY_OP(NUMBER_VAL, *, multiplyInts); break;
+            case OP_DIVIDE:   BINARY_OP(NUMBER_VAL, /, divideInts); break;
             case OP_NOT:
                 push(BOOL_VAL(isFalsey(pop())));
                 break;
@@ -191,7 +383,12 @@ static InterpretResult run() {
                 // We should peek and not pop the result because the garbage collector
                 // should be able to find the constants if a collection is trigger during
                 // an operation
+                if (IS_INT(peek(0))) {
+                    push(negateInt(AS_INT(pop())));
+                    break;
+                }
                 if (!IS_NUMBER(peek(0))) {
+                    PROFILE_TYPE_ERROR(OP_NEGATE);
                     runtimeError("Operand must be a number.");
                     return INTERPRET_RUNTIME_ERROR;
                 }
@@ -202,17 +399,31 @@ static InterpretResult run() {
                 push(constant);
                 break;
             }
+            case OP_SMALL_INT: push(INT_VAL((int8_t)READ_BYTE())); break;
+            case OP_INT:
+                push(INT_VAL(readInlineInt(vm.ip)));
+                vm.ip += sizeof(int32_t);
+                break;
+            case OP_NUMBER:
+                push(NUMBER_VAL(readInlineNumber(vm.ip)));
+                vm.ip += sizeof(double);
+                break;
             case OP_NIL: push(NIL_VAL); break;
             case OP_TRUE: push(BOOL_VAL(true)); break;
             case OP_FALSE: push(BOOL_VAL(false)); break;
             case OP_EQUAL: {
-                Value b = pop();
-                Value a = pop();
-                push(BOOL_VAL(valuesEqual(a, b)));
+                // same as OP_RETURN, comparing strings can flatten them, so we pop after the comparison
+                bool equal = valuesEqual(peek(1), peek(0));
+                pop();
+                pop();
+                push(BOOL_VAL(equal));
                 break;
             }
-            case OP_GREATER:  BINARY_OP(BOOL_VAL, >); break;
-            case OP_LESS:     BINARY_OP(BOOL_VAL, <); break;
+            case OP_GREATER:  BINARY_OP(BOOL_VAL, >, greaterInts); break;
+            case OP_LESS:     BINARY_OP(BOOL_VAL, <, lessInts); break;
+            // only verified chunks get here, so there are no other opcodes,
+            // and the switch can jump without checking the range first
+            default: SIEW_UNREACHABLE();
         }
     }
 
@@ -221,20 +432,440 @@ static InterpretResult run() {
 #undef BINARY_OP
 }
 
-InterpretResult interpret(const char* source) {
+// Same as run(), but ip, the stack top pointer and the value on top of the stack live in local variables
+// (registers, if the C compiler can), instead of going to vm.ip/vm.stackTop in memory on every push and pop.
+//
+// The value on top is only in tos: its slot in the stack (*top) is stale. Everything below it is up to date.
+// Pushing writes tos to its slot first, and popping reloads tos from the slot below, so with an empty stack
+// top points to the spare slot under vm.stack (see reserveStack()).
+// Before anything that can look at the stack or ip from outside (the GC, runtimeError(), printing),
+// we SPILL() them back to the VM.
+// publishIp also writes ip back after every opcode, for the sampling profiler. It is always a constant,
+// so each caller gets its own copy of the loop, and runCached() doesn't pay for it.
+static SIEW_ALWAYS_INLINE InterpretResult runCachedLoop(bool publishIp) {
+    uint8_t* ip = vm.ip;
+    Value* top = vm.stackTop - 1;
+    Value tos = *top;
+    uint64_t executed = 0; // goes to vm.stats.instructions with the rest of the state, in SPILL()
+
+#define READ_BYTE() (*ip++)
+#define READ_CONSTANT() (vm.chunk->constants.values[READ_BYTE()])
+#define PUSH(value) do { *top++ = tos; tos = (value); } while (false)
+#define SPILL() \
+    do { \
+        *top = tos; \
+        vm.stackTop = top + 1; \
+        vm.ip = ip; \
+        vm.stats.instructions += executed; \
+        executed = 0; \
+    } while (false)
+#define RELOAD() do { top = vm.stackTop - 1; tos = *top; ip = vm.ip; } while (false)
+
+// the left operand is the one below the top, the result takes its place
+#define BINARY_OP(valueType, op, intOp) \
+    do { \
+        Value a = top[-1]; \
+        if (BOTH_INTS(tos, a)) { \
+            top--; \
+            tos = intOp(AS_INT(a), AS_INT(tos)); \
+            break; \
+        } \
+        if (!IS_NUMBER(tos) || !IS_NUMBER(a)) { \
+            if (IS_ARRAY(tos) && IS_ARRAY(a)) { \
+                SPILL(); \
+                Value result; \
+                if (!arrayOperation(instruction, a, tos, &result)) return INTERPRET_RUNTIME_ERROR; \
+                top--; \
+                tos = result; \
+                break; \
+            } \
+            PROFILE_TYPE_ERROR(instruction); \
+            SPILL(); \
+            runtimeError("Operands must be numbers."); \
+            return INTERPRET_RUNTIME_ERROR; \
+        } \
+        top--; \
+        tos = valueType(AS_NUMBER(a) op AS_NUMBER(tos)); \
+    } while (false)
+
+    PROFILE_START();
+    for (;;) {
+#ifdef DEBUG_TRACE_EXECUTION
+        SPILL();
+        printOutput(vm.output, "          ");
+        for (Value* slot = vm.stack; slot < vm.stackTop; slot++)
+        {
+            printOutput(vm.output, "[ ");
+            printValue(*slot);
+            printOutput(vm.output, " ]");
+        }
+        printOutput(vm.output, "\n");
+        disassembleInstruction(vm.chunk, (int) (ip - vm.chunk->code));
+#endif
+
+        uint8_t instruction = READ_BYTE();
+        executed++;
+        if (publishIp) VM_PUBLISH_IP(ip);
+        PROFILE_INSTRUCTION(instruction);
+        switch (instruction) {
+            case OP_RETURN:
+                SPILL();
+                printValue(peek(0));
+                writeOutput(vm.output, "\n", 1);
+                pop();
+                return INTERPRET_OK;
+            case OP_ADD:
+                if (BOTH_INTS(tos, top[-1])) {
+                    int32_t b = AS_INT(tos);
+                    int32_t a = AS_INT(*--top);
+                    tos = addInts(a, b);
+                } else if (IS_NUMBER(tos) && IS_NUMBER(top[-1])) {
+                    double b = AS_NUMBER(tos);
+                    double a = AS_NUMBER(*--top);
+                    tos = NUMBER_VAL(a + b);
+                } else if (IS_STRING(tos) && IS_STRING(top[-1])) {
+                    PROFILE_ADD_STRINGS();
+                    SPILL();
+                    if (!concatenate()) return INTERPRET_RUNTIME_ERROR;
+                    RELOAD();
+                } else if (IS_ARRAY(tos) && IS_ARRAY(top[-1])) {
+                    SPILL();
+                    Value result;
+                    if (!arrayOperation(OP_ADD, top[-1], tos, &result)) return INTERPRET_RUNTIME_ERROR;
+                    top--;
+                    tos = result;
+                } else {
+                    PROFILE_TYPE_ERROR(OP_ADD);
+                    SPILL();
+                    runtimeError("Operands must be numbers or strings.");
+                    return INTERPRET_RUNTIME_ERROR;
+                }
+                break;
+            case OP_SUBTRACT: BINARY_OP(NUMBER_VAL, -, subtractInts); break;
+            case OP_MULTIPLY: BINARY_OP(NUMBER_VAL, *, multiplyInts); break;
+            case OP_DIVIDE:   BINARY_OP(NUMBER_VAL, /, divideInts); break;
+            case OP_NOT:
+                tos = BOOL_VAL(isFalsey(tos));
+                break;
+            case OP_NEGATE:
+                if (IS_INT(tos)) {
+                    tos = negateInt(AS_INT(tos));
+                    break;
+                }
+                if (!IS_NUMBER(tos)) {
+                    PROFILE_TYPE_ERROR(OP_NEGATE);
+                    SPILL();
+                    runtimeError("Operand must be a number.");
+                    return INTERPRET_RUNTIME_ERROR;
+                }
+                tos = NUMBER_VAL(-AS_NUMBER(tos));
+                break;
+            case OP_CONSTANT: PUSH(READ_CONSTANT()); break;
+            case OP_SMALL_INT: PUSH(INT_VAL((int8_t)READ_BYTE())); break;
+            case OP_INT:
+                PUSH(INT_VAL(readInlineInt(ip)));
+                ip += sizeof(int32_t);
+                break;
+            case OP_NUMBER:
+                PUSH(NUMBER_VAL(readInlineNumber(ip)));
+                ip += sizeof(double);
+                break;
+            case OP_NIL: PUSH(NIL_VAL); break;
+            case OP_TRUE: PUSH(BOOL_VAL(true)); break;
+            case OP_FALSE: PUSH(BOOL_VAL(false)); break;
+            case OP_EQUAL: {
+                Value a = *--top;
+                bool equal;
+                if (BOTH_INTS(a, tos)) {
+                    equal = AS_INT(a) == AS_INT(tos);
+                } else if (IS_NUMBER(a) && IS_NUMBER(tos)) {
+                    equal = AS_NUMBER(a) == AS_NUMBER(tos); // 1 == 1.0
+                } else if (a.type != tos.type) {
+                    equal = false;
+                } else if (IS_BOOL(a)) {
+                    equal = AS_BOOL(a) == AS_BOOL(tos);
+                } else if (IS_NIL(a)) {
+                    equal = true;
+                } else {
+                    // comparing strings can flatten them (allocating), so the GC has to see both operands
+                    top++;
+                    SPILL();
+                    equal = valuesEqual(a, tos);
+                    top--;
+                }
+                tos = BOOL_VAL(equal);
+                break;
+            }
+            case OP_GREATER:  BINARY_OP(BOOL_VAL, >, greaterInts); break;
+            case OP_LESS:     BINARY_OP(BOOL_VAL, <, lessInts); break;
+            default: SIEW_UNREACHABLE();
+        }
+    }
+
+#undef READ_BYTE
+#undef READ_CONSTANT
+#undef PUSH
+#undef SPILL
+#undef RELOAD
+#undef BINARY_OP
+}
+
+static InterpretResult runCached() {
+    return runCachedLoop(false);
+}
+
+// What runs while sampling, whatever vm.cacheRegisters says: here vm.ip always points right after
+// the opcode that is running, which is where the signal handler looks for it
+static InterpretResult runCachedSampled() {
+    return runCachedLoop(true);
+}
+
+// Runs register code (see FOR_EACH_REGISTER_OPCODE). The frame goes where the stack VM keeps its stack:
+// the constants are copied in, the registers after them start as nil, and stackTop covers the whole frame,
+// so the GC sees every register like it would see the stack. A helper that pushes a temporary (interning a string
+// for R_EQUAL, say) puts it right after the frame, in the STACK_SLACK slot interpretChunk() reserved past maxStack.
+// ip is local. Before anything that can allocate or report an error we SYNC() it (and the instruction count)
+// back to the VM, and like in the other loops it points right after the opcode being run.
+// There are no PROFILE_ hooks here, the opcode profiler counts stack opcodes.
+static InterpretResult runRegisters() {
+    Chunk* chunk = vm.chunk;
+    Value* frame = vm.stack;
+    int constants = chunk->constants.count;
+    memcpy(frame, chunk->constants.values, sizeof(Value) * (size_t)constants);
+    for (int slot = constants; slot < chunk->maxStack; slot++) frame[slot] = NIL_VAL;
+    vm.stackTop = frame + chunk->maxStack;
+
+    uint8_t* ip = vm.ip;
+    uint64_t executed = 0;
+
+#define OPERAND(n) (frame[readRegisterOperand(ip + 2 * (n))])
+#define SYNC() \
+    do { \
+        vm.ip = ip; \
+        vm.stats.instructions += executed; \
+        executed = 0; \
+    } while (false)
+#define FAIL(message) \
+    do { \
+        SYNC(); \
+        runtimeError(message); \
+        return INTERPRET_RUNTIME_ERROR; \
+    } while (false)
+#define BINARY_OP(valueType, op, intOp) \
+    do { \
+        Value a = OPERAND(1); \
+        Value b = OPERAND(2); \
+        if (BOTH_INTS(a, b)) { \
+            OPERAND(0) = intOp(AS_INT(a), AS_INT(b)); \
+        } else if (IS_NUMBER(a) && IS_NUMBER(b)) { \
+            OPERAND(0) = valueType(AS_NUMBER(a) op AS_NUMBER(b)); \
+        } else { \
+            if (!IS_ARRAY(a) || !IS_ARRAY(b)) FAIL("Operands must be numbers."); \
+            SYNC(); \
+            Value result; \
+            if (!arrayOperation(registerOpcodeInfo[instruction].stackOp, a, b, &result)) return INTERPRET_RUNTIME_ERROR; \
+            OPERAND(0) = result; \
+        } \
+        ip += 6; \
+    } while (false)
+
+    for (;;) {
+#ifdef DEBUG_TRACE_EXECUTION
+        printOutput(vm.output, "          ");
+        for (Value* slot = frame + constants; slot < vm.stackTop; slot++) {
+            printOutput(vm.output, "[ ");
+            printValue(*slot);
+            printOutput(vm.output, " ]");
+        }
+        printOutput(vm.output, "\n");
+        disassembleInstruction(chunk, (int)(ip - chunk->code));
+#endif
+
+        uint8_t instruction = *ip++;
+        executed++;
+        switch (instruction) {
+            case R_ADD: {
+                Value a = OPERAND(1);
+                Value b = OPERAND(2);
+                if (BOTH_INTS(a, b)) {
+                    OPERAND(0) = addInts(AS_INT(a), AS_INT(b));
+                } else if (IS_NUMBER(a) && IS_NUMBER(b)) {
+                    OPERAND(0) = NUMBER_VAL(AS_NUMBER(a) + AS_NUMBER(b));
+                } else if (IS_STRING(a) && IS_STRING(b)) {
+                    // a and b stay in their slots until the rope is in dst, a collection in between still sees them
+                    SYNC();
+                    ENTER_ALLOCATION_SITE("concatenate");
+                    ObjString* result = concatenateStrings(AS_STRING(a), AS_STRING(b));
+                    LEAVE_ALLOCATION_SITE();
+                    if (result == NULL) FAIL("String too long.");
+                    OPERAND(0) = OBJ_VAL(result);
+                } else if (IS_ARRAY(a) && IS_ARRAY(b)) {
+                    SYNC();
+                    Value result;
+                    if (!arrayOperation(OP_ADD, a, b, &result)) return INTERPRET_RUNTIME_ERROR;
+                    OPERAND(0) = result;
+                } else {
+                    FAIL("Operands must be numbers or strings.");
+                }
+                ip += 6;
+                break;
+            }
+            case R_SUBTRACT: BINARY_OP(NUMBER_VAL, -, subtractInts); break;
+            case R_MULTIPLY: BINARY_OP(NUMBER_VAL, *, multiplyInts); break;
+            case R_DIVIDE:   BINARY_OP(NUMBER_VAL, /, divideInts); break;
+            case R_GREATER:  BINARY_OP(BOOL_VAL, >, greaterInts); break;
+            case R_LESS:     BINARY_OP(BOOL_VAL, <, lessInts); break;
+            case R_EQUAL: {
+                Value a = OPERAND(1);
+                Value b = OPERAND(2);
+                // comparing strings can flatten them (allocating)
+                if (IS_OBJ(a)) SYNC();
+                OPERAND(0) = BOOL_VAL(valuesEqual(a, b));
+                ip += 6;
+                break;
+            }
+            case R_NOT:
+                OPERAND(0) = BOOL_VAL(isFalsey(OPERAND(1)));
+                ip += 4;
+                break;
+            case R_NEGATE: {
+                Value value = OPERAND(1);
+                if (IS_INT(value)) {
+                    OPERAND(0) = negateInt(AS_INT(value));
+                } else {
+                    if (!IS_NUMBER(value)) FAIL("Operand must be a number.");
+                    OPERAND(0) = NUMBER_VAL(-AS_NUMBER(value));
+                }
+                ip += 4;
+                break;
+            }
+            case R_NUMBER:
+                OPERAND(0) = NUMBER_VAL(readInlineNumber(ip + 2));
+                ip += 2 + sizeof(double);
+                break;
+            case R_RETURN:
+                SYNC();
+                printValue(OPERAND(0));
+                writeOutput(vm.output, "\n", 1);
+                resetStack();
+                return INTERPRET_OK;
+            // verified, like in run()
+            default: SIEW_UNREACHABLE();
+        }
+    }
+
+#undef OPERAND
+#undef SYNC
+#undef FAIL
+#undef BINARY_OP
+}
+
+// Either source or file is set. sizeHint is how big we think the source is, 0 when we can't know (a stream).
+// Runs a chunk that is already compiled. The chunk stays the caller's. If it's not verified yet
+// (it didn't come from compile()) it is verified now, and rejected as a compile error if it's not valid.
+InterpretResult interpretChunk(Chunk* chunk) {
+    // run() believes every byte (opcodes, constant indexes, stack depth), so code we didn't compile is checked first
+    VerifyError error;
+    if (!chunk->verified && !verifyChunk(chunk, &error)) {
+        flushOutput(vm.output);
+        fprintf(stderr, "Invalid bytecode at %d: %s\n", error.offset, error.message);
+        return INTERPRET_COMPILE_ERROR;
+    }
+
+    // the only bounds check of the whole run
+    if (!reserveStack((size_t)chunk->maxStack + STACK_SLACK)) {
+        flushOutput(vm.output);
+        fprintf(stderr, "Out of memory: no room for a stack of %d values.\n", chunk->maxStack);
+        return INTERPRET_RUNTIME_ERROR;
+    }
+
+    // If an allocation goes over vm.heapLimit (even after collecting garbage) reallocate() can't just return,
+    // every caller expects memory. Instead, it jumps back here, in the middle of whatever we were doing,
+    // and we report it as a runtime error. The host survives, and the VM can keep being used.
+    jmp_buf outOfMemory;
+    if (setjmp(outOfMemory) != 0) {
+        vm.outOfMemoryJump = NULL;
+        allocationSite = NULL; // nobody is left to leave the site we jumped out of
+        runtimeError("Out of memory.");
+        VM_PUBLISH_CHUNK(NULL);
+        return INTERPRET_RUNTIME_ERROR;
+    }
+    vm.outOfMemoryJump = &outOfMemory;
+
+    vm.stats.chunks++;
+    vm.stats.codeBytes += (uint64_t)chunk->count;
+    vm.stats.constants += (uint64_t)chunk->constants.count;
+    if ((uint64_t)chunk->count > vm.stats.maxCodeBytes) vm.stats.maxCodeBytes = (uint64_t)chunk->count;
+    if ((uint64_t)chunk->constants.count > vm.stats.maxConstants) vm.stats.maxConstants = (uint64_t)chunk->constants.count;
+
+    VM_PUBLISH_CHUNK(chunk);
+    VM_PUBLISH_IP(chunk->code);
+
+    InterpretResult result;
+    if (chunk->backend == BACKEND_REGISTER) {
+        result = runRegisters();
+    } else if (vm.sampling) {
+        result = runCachedSampled();
+    } else {
+        result = vm.cacheRegisters ? runCached() : run();
+    }
+    // the host (or the REPL prompt) comes next, so what the program printed goes out now
+    flushOutput(vm.output);
+
+    // from here on, nobody should look at this chunk (the GC and the sampler included)
+    VM_PUBLISH_CHUNK(NULL);
+    vm.outOfMemoryJump = NULL;
+    return result;
+}
+
+static InterpretResult interpretSource(const char* source, FILE* file, int sizeHint) {
     Chunk chunk;
-    initChunk(&chunk);
 
-    if (!compile(source, &chunk)) {
+    // same as interpretChunk(), for running out of memory while compiling
+    jmp_buf outOfMemory;
+    if (setjmp(outOfMemory) != 0) {
+        vm.outOfMemoryJump = NULL;
+        allocationSite = NULL;
+        abortCompilation();
+        flushOutput(vm.output);
+        fputs("Out of memory while compiling.\n", stderr);
+        resetStack();
+        // the chunk buffers (and whatever half-built things) live in the arena, so this is all the cleanup we need
+        resetArena(&vm.compileArena);
+        return INTERPRET_RUNTIME_ERROR;
+    }
+    vm.outOfMemoryJump = &outOfMemory;
+
+    // The chunk lives exactly as long as this call, so all its buffers come from the compile arena
+    // and are released together at the end, instead of one realloc/free at a time.
+    initChunkInArena(&chunk, &vm.compileArena, sizeHint);
+    chunk.backend = vm.sampling ? BACKEND_STACK : vm.backend;
+
+    markCompiling(true);
+    bool compiled = file != NULL ? compileFile(file, &chunk) : compile(source, &chunk);
+    markCompiling(false);
+    if (!compiled) {
         freeChunk(&chunk);
+        resetArena(&vm.compileArena);
+        vm.outOfMemoryJump = NULL;
         return INTERPRET_COMPILE_ERROR;
     }
 
-    vm.chunk = &chunk;
-    vm.ip = vm.chunk->code;
-
-    InterpretResult result = run();
+    vm.outOfMemoryJump = NULL;
+    InterpretResult result = interpretChunk(&chunk);
 
     freeChunk(&chunk);
+    resetArena(&vm.compileArena);
     return result;
+}
+
+InterpretResult interpret(const char* source) {
+    // an mmapped script can be bigger than an int, and the chunk only wants a rough hint anyway
+    size_t length = strlen(source);
+    return interpretSource(source, NULL, length > INT_MAX ? INT_MAX : (int)length);
+}
+
+// The program is read from file while it compiles, it is never fully in memory. The file is not closed.
+InterpretResult interpretFile(FILE* file) {
+    return interpretSource(NULL, file, 0);
 }
\ No newline at end of file